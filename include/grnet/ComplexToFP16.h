@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_COMPLEXTOFP16_H
+#define INCLUDED_GRNET_COMPLEXTOFP16_H
+
+#include <gnuradio/sync_interpolator.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts complex samples to interleaved half precision (FP16) or
+ * bfloat16 values.
+ * \ingroup grnet
+ *
+ * Each sample becomes two 16-bit values (I then Q) in host order, half
+ * the size of gr_complex, so it can go out as a short stream through the
+ * UDP/TCP sinks.  FP16 keeps 11 bits of precision up to +/-65504 (larger
+ * values become inf); bfloat16 keeps float's range with 8 bits.
+ *
+ * Both round to nearest even, keep NaNs as (quiet) NaNs and keep
+ * denormals rather than flushing them to zero.  The output is the same
+ * whether the CPU's F16C, AVX-512 BF16 or AVX2 path or the scalar code
+ * does the conversion.
+ */
+class GRNET_API ComplexToFP16 : virtual public gr::sync_interpolator {
+public:
+  typedef std::shared_ptr<ComplexToFP16> sptr;
+
+  /*!
+   * \param bfloat16 Use bfloat16 rather than IEEE FP16.
+   */
+  static sptr make(bool bfloat16 = false);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_COMPLEXTOFP16_H */
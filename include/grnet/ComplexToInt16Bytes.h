@@ -43,8 +43,11 @@ public:
    * constructor is in a private implementation
    * class. grnet::ComplexToInt16Bytes::make is the public interface for
    * creating new instances.
+   *
+   * \param bigEndian Samples are big-endian (network order, e.g.
+   * VITA-49) rather than host order.
    */
-  static sptr make();
+  static sptr make(bool bigEndian = false);
 };
 
 } // namespace grnet
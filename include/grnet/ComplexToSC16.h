@@ -23,6 +23,7 @@
 
 #include <gnuradio/sync_interpolator.h>
 #include <grnet/api.h>
+#include <climits>
 
 namespace gr {
 namespace grnet {
@@ -43,8 +44,25 @@ public:
    * constructor is in a private implementation
    * class. grnet::ComplexToSC16::make is the public interface for
    * creating new instances.
+   *
+   * \param bigEndian Samples are big-endian (network order, e.g.
+   * VITA-49) rather than host order.
+   * \param scale Output = (input + offset) * scale, so the default maps
+   * +/-1.0 to full scale.
+   * \param offset DC offset added to I and Q before scaling.
+   * \param nthreads Threads to split each work() call across when it's
+   * large enough to be worth it.  1 (the default) does everything on the
+   * block's own thread.  Above 1, the block works in multiples of
+   * 32768 samples with an output buffer sized for all threads.
+   */
+  static sptr make(bool bigEndian = false, float scale = SHRT_MAX,
+                   gr_complex offset = gr_complex(0, 0), int nthreads = 1);
+
+  /*!
+   * Number of I/Q values that were beyond full scale and clipped since
+   * the block was created.
    */
-  static sptr make();
+  virtual uint64_t saturated() const = 0;
 };
 
 } // namespace grnet
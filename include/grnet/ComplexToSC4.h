@@ -0,0 +1,57 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_COMPLEXTOSC4_H
+#define INCLUDED_GRNET_COMPLEXTOSC4_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts complex samples to packed 4-bit I/Q (SC4), 1 byte per
+ * sample.
+ * \ingroup grnet
+ *
+ * I goes in the low nibble and Q in the high nibble.  Output = input *
+ * scale, rounded to nearest and clipped at the 4-bit limits.
+ */
+class GRNET_API ComplexToSC4 : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<ComplexToSC4> sptr;
+
+  /*!
+   * \param scale Full scale value: +/-1.0 maps to +/-scale.
+   */
+  static sptr make(float scale = 7.0f);
+
+  /*!
+   * Number of I/Q values that were beyond full scale and clipped since
+   * the block was created.
+   */
+  virtual uint64_t saturated() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_COMPLEXTOSC4_H */
@@ -23,6 +23,7 @@
 
 #include <gnuradio/sync_interpolator.h>
 #include <grnet/api.h>
+#include <climits>
 
 namespace gr {
 namespace grnet {
@@ -43,8 +44,19 @@ public:
    * constructor is in a private implementation
    * class. grnet::ComplexToSigned8::make is the public interface for
    * creating new instances.
+   *
+   * \param scale Output = (input + offset) * scale, so the default maps
+   * +/-1.0 to full scale.
+   * \param offset DC offset added to I and Q before scaling.
+   */
+  static sptr make(float scale = SCHAR_MAX,
+                   gr_complex offset = gr_complex(0, 0));
+
+  /*!
+   * Number of I/Q values that were beyond full scale and clipped since
+   * the block was created.
    */
-  static sptr make();
+  virtual uint64_t saturated() const = 0;
 };
 
 } // namespace grnet
@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_COMPLEXTOUNSIGNED8_H
+#define INCLUDED_GRNET_COMPLEXTOUNSIGNED8_H
+
+#include <gnuradio/sync_interpolator.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts complex samples to interleaved unsigned8 (offset
+ * binary, RTL-SDR style).
+ * \ingroup grnet
+ *
+ * Output = input * 127.5 + 127.5, rounded to nearest and clipped to
+ * 0-255.
+ */
+class GRNET_API ComplexToUnsigned8 : virtual public gr::sync_interpolator {
+public:
+  typedef std::shared_ptr<ComplexToUnsigned8> sptr;
+
+  /*!
+   * \brief Return a shared_ptr to a new instance of
+   * grnet::ComplexToUnsigned8.
+   */
+  static sptr make();
+
+  /*!
+   * Number of I/Q values that were beyond full scale and clipped since
+   * the block was created.
+   */
+  virtual uint64_t saturated() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_COMPLEXTOUNSIGNED8_H */
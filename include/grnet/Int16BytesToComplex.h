@@ -43,8 +43,15 @@ public:
    * constructor is in a private implementation
    * class. grnet::Int16BytesToComplex::make is the public interface for
    * creating new instances.
+   *
+   * \param bigEndian Samples are big-endian (network order, e.g.
+   * VITA-49) rather than host order.
+   * \param nontemporalThreshold Work calls producing at least this many
+   * bytes are written with non-temporal (streaming) stores, which keep the
+   * output from evicting the working set of the blocks downstream.  0
+   * (the default) never streams.
    */
-  static sptr make();
+  static sptr make(bool bigEndian = false, size_t nontemporalThreshold = 0);
 };
 
 } // namespace grnet
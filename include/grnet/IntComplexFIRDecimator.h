@@ -0,0 +1,58 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_INTCOMPLEXFIRDECIMATOR_H
+#define INCLUDED_GRNET_INTCOMPLEXFIRDECIMATOR_H
+
+#include <gnuradio/sync_decimator.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Decimating FIR filter for interleaved 8-bit or 16-bit complex
+ * streams, computed in integer arithmetic.
+ * \ingroup grnet
+ *
+ * Like ByteComplexDecimator, the stream is bytes (itemsize 1) or shorts
+ * (itemsize 2) holding I/Q pairs, and the output is the same format.  The
+ * real taps are applied to I and Q before decimating, so out of band
+ * energy doesn't alias into the result, without converting to float
+ * first.  Taps are quantized to 16 bits (see int_fir_decimator for the
+ * details).
+ */
+class GRNET_API IntComplexFIRDecimator : virtual public gr::sync_decimator {
+public:
+  typedef std::shared_ptr<IntComplexFIRDecimator> sptr;
+
+  /*!
+   * \param itemsize 1 for interleaved int8, 2 for interleaved int16.
+   * \param decimation Decimation, in complex samples.
+   * \param taps Real filter taps, e.g. from firdes.low_pass.
+   */
+  static sptr make(size_t itemsize, int decimation,
+                   const std::vector<float> &taps);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_INTCOMPLEXFIRDECIMATOR_H */
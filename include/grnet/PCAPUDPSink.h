@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_PCAPUDPSINK_H
+#define INCLUDED_GRNET_PCAPUDPSINK_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Writes a sample stream to a pcap file as UDP packets.
+ * \ingroup grnet
+ *
+ * \details
+ * Packs the input into UDP payloads exactly the way the UDP sink does
+ * (same header types and payload size), wraps each one in synthetic
+ * Ethernet/IPv4/UDP headers addressed to the given port, and writes them
+ * to a nanosecond pcap file.  The result replays with the PCAP UDP Source
+ * using the same port, header and payload settings, and opens in the
+ * usual capture tools.  It takes the place of running tcpdump alongside
+ * a UDP sink, without the socket and capture overhead or the drops.
+ *
+ * Packets are staged in a large page-aligned buffer and written out in
+ * big blocks.  With directIO set the file is opened O_DIRECT, bypassing
+ * the page cache (useful for long recordings to fast storage); if the
+ * filesystem doesn't support it, normal buffered writes are used.
+ *
+ * Packet timestamps count samples at sampleRate from the time the first
+ * sample arrives (wall clock).  With useRxTime set, an rx_time tag resets
+ * the timeline to the tag's time at the tagged sample.  A sampleRate of 0
+ * stamps every packet with the wall clock when it is written.  A partial
+ * packet left over at the end of the stream is not written.
+ */
+class GRNET_API PCAPUDPSink : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<PCAPUDPSink> sptr;
+
+  /*!
+   * Build a PCAPUDPSink block.
+   */
+  static sptr make(size_t itemsize, size_t vecLen, const std::string &filename,
+                   int port, int headerType, int payloadsize,
+                   double sampleRate, bool useRxTime = true,
+                   bool directIO = false);
+
+  /*!
+   * Packets and bytes (including pcap record headers) written so far.
+   */
+  virtual uint64_t packets_written() const = 0;
+  virtual uint64_t bytes_written() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_PCAPUDPSINK_H */
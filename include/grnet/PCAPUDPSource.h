@@ -21,18 +21,56 @@
 #ifndef INCLUDED_GRNET_PCAPUDPSOURCE_H
 #define INCLUDED_GRNET_PCAPUDPSOURCE_H
 
-#include <gnuradio/sync_block.h>
+#include <gnuradio/block.h>
 #include <grnet/api.h>
+#include <string>
+#include <vector>
 
 namespace gr {
 namespace grnet {
 
 /*!
- * \brief <+description of block+>
+ * \brief Replays the UDP payloads for one or more ports from a capture file.
  * \ingroup grnet
  *
+ * \details
+ * Reads a pcap or pcapng file and outputs the payloads of the UDP packets
+ * sent to the given port, handling the same headers as the UDP source.
+ * Each of additionalPorts gets an output of its own (output 1, 2, ...),
+ * with its own sequence tracking.  All of them are demultiplexed from a
+ * single pass through the file, so replaying N channels costs one read
+ * rather than N.
+ *
+ * Packets are released on the capture's own timeline: each packet is
+ * scheduled at (capture time - first capture time) / rate after playback
+ * starts, so bursts and gaps are reproduced instead of drifting, and
+ * packets on different ports keep their captured timing relative to each
+ * other.  A rate of 2.0 plays twice as fast, 0.5 at half speed, and 0
+ * disables pacing.  How closely the schedule was met is available from
+ * the pacing_error_* getters.
+ *
+ * pcap and pcapng files (microsecond or nanosecond timestamps) are
+ * supported, with Ethernet (including QinQ), Linux cooked (SLL/SLL2, from
+ * tcpdump -i any), loopback and raw IP link types carrying IPv4 or IPv6.
+ * Fragmented IPv4 datagrams (jumbo frames captured on a smaller MTU) are
+ * reassembled before they are delivered.
+ * With tagCaptureTime set, the first sample from each packet is tagged
+ * with the packet's capture time as a capture_time tag in the same
+ * (uint64 seconds, double fractional seconds) format as rx_time.
+ *
+ * startTime (seconds after the port's first packet) and duration (seconds,
+ * 0 for the rest of the file) select a window to play; with repeat set the
+ * window loops.  Starting part way in uses a packet index kept next to the
+ * capture (<file>.grnetidx), built the first time it is needed or ahead of
+ * time with build_index() / the grnet_pcap_index tool, so playback jumps
+ * straight to the window instead of reading everything in front of it.
+ *
+ * With repeat set and preloadMB non-zero, the matching payloads are kept
+ * in memory (up to preloadMB megabytes) on the first pass and later
+ * passes replay from there without reading or parsing the file.  If the
+ * traffic doesn't fit, every pass streams from the file as usual.
  */
-class GRNET_API PCAPUDPSource : virtual public gr::sync_block {
+class GRNET_API PCAPUDPSource : virtual public gr::block {
 public:
   typedef std::shared_ptr<PCAPUDPSource> sptr;
 
@@ -45,7 +83,39 @@ public:
    * creating new instances.
    */
   static sptr make(size_t itemsize, int port, int headerType, int payloadsize,
-                   bool notifyMissed, const char *filename, bool repeat);
+                   bool notifyMissed, const char *filename, bool repeat,
+                   double rate = 1.0, bool tagCaptureTime = false,
+                   double startTime = 0.0, double duration = 0.0,
+                   const std::vector<int> &additionalPorts = std::vector<int>(),
+                   int preloadMB = 0);
+
+  /*!
+   * Build (or rebuild) the packet index for a capture, with an entry per
+   * port at least every interval seconds of capture time.  Returns the
+   * name of the index file.  Throws on error.
+   */
+  static std::string build_index(const std::string &filename,
+                                 double interval = 0.1);
+
+  /*!
+   * Mean and worst absolute difference between when packets were
+   * scheduled and when they were actually released, in microseconds.
+   */
+  virtual double pacing_error_mean_us() const = 0;
+  virtual double pacing_error_max_us() const = 0;
+
+  /*!
+   * Number of packets paced so far.
+   */
+  virtual uint64_t packets_paced() const = 0;
+
+  /*!
+   * Fragmented IPv4 datagrams that were put back together, and those that
+   * were dropped because fragments were missing (timed out, evicted or
+   * inconsistent).
+   */
+  virtual uint64_t datagrams_reassembled() const = 0;
+  virtual uint64_t datagrams_incomplete() const = 0;
 };
 
 } // namespace grnet
@@ -0,0 +1,54 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_SC12TOCOMPLEX_H
+#define INCLUDED_GRNET_SC12TOCOMPLEX_H
+
+#include <gnuradio/sync_decimator.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts packed 12-bit I/Q (SC12), 3 bytes per sample, to
+ * complex.
+ * \ingroup grnet
+ *
+ * The layout is as written by ComplexToSC12.  Output = input / scale.
+ */
+class GRNET_API SC12ToComplex : virtual public gr::sync_decimator {
+public:
+  typedef std::shared_ptr<SC12ToComplex> sptr;
+
+  /*!
+   * \param scale Full scale value: +/-1.0 maps to +/-scale.
+   * \param nontemporalThreshold Work calls producing at least this many
+   * bytes are written with non-temporal (streaming) stores, which keep the
+   * output from evicting the working set of the blocks downstream.  0
+   * (the default) never streams.
+   */
+  static sptr make(float scale = 2047.0f, size_t nontemporalThreshold = 0);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_SC12TOCOMPLEX_H */
@@ -43,8 +43,20 @@ public:
    * constructor is in a private implementation
    * class. grnet::SC16ToComplex::make is the public interface for
    * creating new instances.
+   *
+   * \param bigEndian Samples are big-endian (network order, e.g.
+   * VITA-49) rather than host order.
+   * \param nthreads Threads to split each work() call across when it's
+   * large enough to be worth it.  1 (the default) does everything on the
+   * block's own thread.  Above 1, the block works in multiples of
+   * 16384 samples with an output buffer sized for all threads.
+   * \param nontemporalThreshold Work calls producing at least this many
+   * bytes are written with non-temporal (streaming) stores, which keep the
+   * output from evicting the working set of the blocks downstream.  0
+   * (the default) never streams.
    */
-  static sptr make();
+  static sptr make(bool bigEndian = false, int nthreads = 1,
+                   size_t nontemporalThreshold = 0);
 };
 
 } // namespace grnet
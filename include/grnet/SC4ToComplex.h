@@ -0,0 +1,53 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_SC4TOCOMPLEX_H
+#define INCLUDED_GRNET_SC4TOCOMPLEX_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts packed 4-bit I/Q (SC4), 1 byte per sample, to complex.
+ * \ingroup grnet
+ *
+ * The layout is as written by ComplexToSC4.  Output = input / scale.
+ */
+class GRNET_API SC4ToComplex : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<SC4ToComplex> sptr;
+
+  /*!
+   * \param scale Full scale value: +/-1.0 maps to +/-scale.
+   * \param nontemporalThreshold Work calls producing at least this many
+   * bytes are written with non-temporal (streaming) stores, which keep the
+   * output from evicting the working set of the blocks downstream.  0
+   * (the default) never streams.
+   */
+  static sptr make(float scale = 7.0f, size_t nontemporalThreshold = 0);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_SC4TOCOMPLEX_H */
@@ -43,8 +43,13 @@ public:
    * constructor is in a private implementation
    * class. grnet::Signed8ToComplex::make is the public interface for
    * creating new instances.
+   *
+   * \param nontemporalThreshold Work calls producing at least this many
+   * bytes are written with non-temporal (streaming) stores, which keep the
+   * output from evicting the working set of the blocks downstream.  0
+   * (the default) never streams.
    */
-  static sptr make();
+  static sptr make(size_t nontemporalThreshold = 0);
 };
 
 } // namespace grnet
@@ -0,0 +1,56 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_UNSIGNED8TOCOMPLEX_H
+#define INCLUDED_GRNET_UNSIGNED8TOCOMPLEX_H
+
+#include <gnuradio/sync_decimator.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts interleaved unsigned8 (offset binary, RTL-SDR style)
+ * samples to complex.
+ * \ingroup grnet
+ *
+ * Output = (input - 127.5) / 127.5.
+ */
+class GRNET_API Unsigned8ToComplex : virtual public gr::sync_decimator {
+public:
+  typedef std::shared_ptr<Unsigned8ToComplex> sptr;
+
+  /*!
+   * \brief Return a shared_ptr to a new instance of
+   * grnet::Unsigned8ToComplex.
+   *
+   * \param nontemporalThreshold Work calls producing at least this many
+   * bytes are written with non-temporal (streaming) stores, which keep the
+   * output from evicting the working set of the blocks downstream.  0
+   * (the default) never streams.
+   */
+  static sptr make(size_t nontemporalThreshold = 0);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_UNSIGNED8TOCOMPLEX_H */
@@ -0,0 +1,86 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_FORMAT_CONVERT_H
+#define INCLUDED_GRNET_FORMAT_CONVERT_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+
+// Sample formats.  Each one is a single complex (I/Q) sample.
+#define SAMPLEFORMAT_FC32 0 // Complex float
+#define SAMPLEFORMAT_SC16 1 // Interleaved int16
+#define SAMPLEFORMAT_SC8 2  // Interleaved int8
+#define SAMPLEFORMAT_SU8 3  // Interleaved offset binary bytes (RTL-SDR)
+#define SAMPLEFORMAT_SC12 4 // Packed 12-bit, 3 bytes
+#define SAMPLEFORMAT_SC4 5  // Packed 4-bit, 1 byte
+#define SAMPLEFORMAT_FP16 6 // Interleaved IEEE half precision
+#define SAMPLEFORMAT_BF16 7 // Interleaved bfloat16
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Converts between any two of the sample formats the single purpose
+ * converters handle.
+ * \ingroup grnet
+ *
+ * Each item is vlen complex samples in the input or output format.  The
+ * integer formats use the same full scale as their dedicated blocks
+ * (32767 for SC16, 127 for SC8, 127.5 around a bias of 127.5 for
+ * unsigned bytes, 2047 for SC12 and 7 for SC4), and scale is a gain on
+ * top of that: 1.0 maps full scale in to full scale out.  Converting
+ * between two integer formats goes through float in cache sized chunks.
+ * Values beyond full scale are clipped and counted.
+ */
+class GRNET_API format_convert : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<format_convert> sptr;
+
+  /*!
+   * \param inputFormat Input sample format (SAMPLEFORMAT_*).
+   * \param outputFormat Output sample format (SAMPLEFORMAT_*).
+   * \param bigEndian SC16 samples on either side are in network byte
+   * order rather than host order.  Only valid with SC16.
+   * \param scale Gain applied in the conversion.
+   * \param vlen Samples per item.
+   * \param nthreads Threads to split each work() call across when it's
+   * large enough to be worth it.  1 (the default) does everything on the
+   * block's own thread.  Above 1, the block works in multiples of 128 KB
+   * of output with an output buffer sized for all threads.
+   * \param nontemporalThreshold With a complex float output, work calls
+   * producing at least this many bytes are written with non-temporal
+   * (streaming) stores.  0 (the default) never streams.
+   */
+  static sptr make(int inputFormat, int outputFormat, bool bigEndian = false,
+                   float scale = 1.0f, int vlen = 1, int nthreads = 1,
+                   size_t nontemporalThreshold = 0);
+
+  /*!
+   * Number of I/Q values that were beyond full scale and clipped since
+   * the block was created.
+   */
+  virtual uint64_t saturated() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_FORMAT_CONVERT_H */
@@ -0,0 +1,68 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_SHM_SINK_H
+#define INCLUDED_GRNET_SHM_SINK_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Streams samples to other processes on the same host through a
+ * shared-memory ring.
+ * \ingroup grnet
+ *
+ * \details
+ * This block creates a POSIX shared-memory segment (/dev/shm/<name>) holding
+ * a ring buffer and copies its input into it.  Any number of shm_source
+ * blocks (up to 16) in other flowgraphs on the same host can attach to the
+ * same name and read the stream.  Compared to UDP over loopback there are
+ * no per-packet syscalls and no packet loss from socket buffers: each
+ * sample is copied once into the ring and once out of it.
+ *
+ * In lossless mode the sink waits for the slowest attached reader, so
+ * nothing is dropped (the flowgraph is back-pressured instead).  With
+ * lossless off the sink never waits and a reader that falls more than a
+ * ring behind skips ahead and reports the samples it missed.  With no
+ * readers attached the sink always free-runs.
+ */
+class GRNET_API shm_sink : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<shm_sink> sptr;
+
+  /*!
+   * Build a shm_sink block.
+   */
+  static sptr make(size_t itemsize, size_t vecLen, const std::string &name,
+                   size_t ringSize = 16777216, bool lossless = true);
+
+  /*!
+   * Number of shm_source blocks currently attached.
+   */
+  virtual int active_readers() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_SHM_SINK_H */
@@ -0,0 +1,64 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_SHM_SOURCE_H
+#define INCLUDED_GRNET_SHM_SOURCE_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Receives samples from a shm_sink in another process on the same
+ * host.
+ * \ingroup grnet
+ *
+ * \details
+ * This block attaches to the shared-memory ring created by a shm_sink with
+ * the same name and copies the stream straight into its output buffer.
+ * It can be started before or after the sink; until the segment exists it
+ * simply waits.  Readers join at the current position in the stream.  When
+ * the sink's flowgraph stops, the source drains what is left and then
+ * finishes.  If the sink isn't running in lossless mode and this reader
+ * falls too far behind, the skipped samples are counted (and optionally
+ * logged) the same way the UDP source reports missed frames.
+ */
+class GRNET_API shm_source : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<shm_source> sptr;
+
+  /*!
+   * Build a shm_source block.
+   */
+  static sptr make(size_t itemsize, size_t vecLen, const std::string &name,
+                   bool notifyMissed = true);
+
+  /*!
+   * Items skipped because the sink overwrote them before they were read.
+   */
+  virtual uint64_t items_missed() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_SHM_SOURCE_H */
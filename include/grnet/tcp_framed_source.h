@@ -0,0 +1,65 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_TCP_FRAMED_SOURCE_H
+#define INCLUDED_GRNET_TCP_FRAMED_SOURCE_H
+
+#include <gnuradio/sync_block.h>
+#include <grnet/api.h>
+#include <grnet/tcp_sink.h>
+
+namespace gr {
+namespace grnet {
+
+/*!
+ * \brief Receives framed streams from the tcp_sink block.
+ * \ingroup grnet
+ *
+ * \details
+ * This block is the receiving side of the tcp_sink framed modes.  It
+ * either connects to a sink running in server mode (TCPSINKMODE_CLIENT)
+ * or listens for a sink connecting in client mode (TCPSINKMODE_SERVER).
+ * Each frame's stream tags are re-attached to the same samples on the
+ * output, so things like rx_time, rx_freq and burst tags survive the link.
+ * Frame sequence numbers are checked so gaps (e.g. a sender restart) can be
+ * reported, and if the receiver ever loses frame sync it scans forward to
+ * the next frame header.  When the sender stamps frames, a frame_time tag
+ * (same (uint64 secs, double frac secs) format as rx_time) marks the first
+ * sample of each frame with its send time.
+ */
+class GRNET_API tcp_framed_source : virtual public gr::sync_block {
+public:
+  typedef std::shared_ptr<tcp_framed_source> sptr;
+
+  /*!
+   * Build a tcp_framed_source block.
+   */
+  static sptr make(size_t itemsize, size_t vecLen, const std::string &host,
+                   int port, int sourceMode = TCPSINKMODE_CLIENT,
+                   bool notifyMissed = true);
+
+  virtual uint64_t frames_received() const = 0;
+  virtual uint64_t frames_missed() const = 0;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_TCP_FRAMED_SOURCE_H */
@@ -27,6 +27,14 @@
 #define TCPSINKMODE_CLIENT 1
 #define TCPSINKMODE_SERVER 2
 
+#define TCPSINKPROFILE_DEFAULT 0
+#define TCPSINKPROFILE_LATENCY 1
+#define TCPSINKPROFILE_THROUGHPUT 2
+
+#define TCPFRAMEMODE_NONE 0
+#define TCPFRAMEMODE_FRAMED 1
+#define TCPFRAMEMODE_FRAMED_TIMESTAMP 2
+
 namespace gr {
 namespace grnet {
 
@@ -44,6 +52,31 @@ namespace grnet {
  * flowgraph will continue to execute.  If/when a new client connection
  * is established, data will then pick up with the current stream for
  * transmission to the new client.
+ *
+ * With zerocopy enabled, data is sent with MSG_ZEROCOPY straight out of
+ * the input buffer rather than being copied into the kernel socket
+ * buffer.  Input is only consumed once the kernel reports it is done
+ * with the pages, so the block may hold items across work() calls.  If
+ * the kernel doesn't support SO_ZEROCOPY, or a send has to be copied
+ * anyway (loopback, optmem limit), the send falls back to a normal copy
+ * and is counted in zerocopy_copied_sends().
+ *
+ * The socket profile trades latency against throughput.  The latency
+ * profile sets TCP_NODELAY and writes each work() call as it arrives.
+ * The throughput profile sets TCP_CORK (pulled briefly after each write
+ * so nothing waits on the kernel's 200 ms cork timer) and a large
+ * SO_SNDBUF, and coalesces small work() calls into writes of at least
+ * coalesceSize bytes.  A partial buffer is flushed once coalesceTimeoutUs
+ * has passed since its first byte was queued, by work() or by a timer if
+ * upstream goes quiet, and on stop().  The default profile leaves the
+ * socket options alone.
+ *
+ * In the framed modes each work() call is sent as one frame carrying a
+ * sequence number, the item count and the stream tags for those items
+ * (see lib/tcp_frame.h), written with a single writev().  The timestamped
+ * mode also stamps each frame with its send time.  Pair with
+ * tcp_framed_source on the receiving side.  Framing replaces coalescing
+ * and zerocopy, which are ignored in these modes.
  */
 class GRNET_API tcp_sink : virtual public gr::sync_block {
 public:
@@ -53,7 +86,27 @@ public:
    * Build a tcp_sink block.
    */
   static sptr make(size_t itemsize, size_t vecLen, const std::string &host,
-                   int port, int sinkMode);
+                   int port, int sinkMode, bool zerocopy = false,
+                   int profile = TCPSINKPROFILE_DEFAULT,
+                   int coalesceSize = 65536, int coalesceTimeoutUs = 2000,
+                   int frameMode = TCPFRAMEMODE_NONE);
+
+  /*!
+   * Number of sends made while zerocopy was requested that ended up
+   * being copied (kernel fallback or no SO_ZEROCOPY support).
+   */
+  virtual uint64_t zerocopy_copied_sends() const = 0;
+
+  /*!
+   * Number of socket writes issued so far.
+   */
+  virtual uint64_t write_count() const = 0;
+
+  /*!
+   * Average bytes per socket write.  With the throughput profile this
+   * shows how well small work() calls are being coalesced.
+   */
+  virtual double avg_write_size() const = 0;
 };
 
 } // namespace grnet
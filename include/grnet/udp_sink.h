@@ -55,6 +55,13 @@ namespace grnet {
  * from the work function.  This block also supports IPv4 and IPv6
  * addresses and is automatically determined from the address
  * provided.
+ *
+ * With zerocopy enabled, each packet's data is sent with MSG_ZEROCOPY
+ * directly from the input buffer instead of passing through the local
+ * queue.  Input is only consumed once the kernel has released the pages,
+ * and a partial packet at the end of the input is left for the next
+ * work() call.  Sends the kernel had to copy are counted in
+ * zerocopy_copied_sends().
  */
 class GRNET_API udp_sink : virtual public gr::sync_block {
 public:
@@ -64,7 +71,14 @@ public:
    * Build a udp_sink block.
    */
   static sptr make(size_t itemsize, size_t vecLen, const std::string &host,
-                   int port, int headerType, int payloadsize, bool send_eof);
+                   int port, int headerType, int payloadsize, bool send_eof,
+                   bool zerocopy = false);
+
+  /*!
+   * Number of sends made while zerocopy was requested that ended up
+   * being copied (kernel fallback or no SO_ZEROCOPY support).
+   */
+  virtual uint64_t zerocopy_copied_sends() const = 0;
 };
 
 } // namespace grnet
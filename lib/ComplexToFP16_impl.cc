@@ -0,0 +1,67 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "ComplexToFP16_impl.h"
+#include "convert_kernels.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+ComplexToFP16::sptr ComplexToFP16::make(bool bfloat16) {
+  return gnuradio::get_initial_sptr(new ComplexToFP16_impl(bfloat16));
+}
+
+/*
+ * The private constructor
+ */
+ComplexToFP16_impl::ComplexToFP16_impl(bool bfloat16)
+    : gr::sync_interpolator("ComplexToFP16",
+                            gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                            gr::io_signature::make(1, 1, sizeof(int16_t)), 2),
+      d_bfloat16(bfloat16) {
+  const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+  set_alignment(std::max(1, alignment_multiple));
+}
+
+/*
+ * Our virtual destructor.
+ */
+ComplexToFP16_impl::~ComplexToFP16_impl() {}
+
+int ComplexToFP16_impl::work(int noutput_items,
+                             gr_vector_const_void_star &input_items,
+                             gr_vector_void_star &output_items) {
+  const float *in = (const float *)input_items[0];
+  int16_t *out = (int16_t *)output_items[0];
+
+  // One 16-bit value out per float in
+  convert_32f_to_16f((uint16_t *)out, in, d_bfloat16, noutput_items);
+
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
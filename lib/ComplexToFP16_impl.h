@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_COMPLEXTOFP16_IMPL_H
+#define INCLUDED_GRNET_COMPLEXTOFP16_IMPL_H
+
+#include <grnet/ComplexToFP16.h>
+
+namespace gr {
+namespace grnet {
+
+class ComplexToFP16_impl : public ComplexToFP16 {
+private:
+  bool d_bfloat16;
+
+public:
+  ComplexToFP16_impl(bool bfloat16);
+  ~ComplexToFP16_impl();
+
+  // Where all the action really happens
+  int work(int noutput_items, gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_COMPLEXTOFP16_IMPL_H */
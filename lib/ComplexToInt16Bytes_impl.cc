@@ -680,23 +680,25 @@
 #endif
 
 #include "ComplexToInt16Bytes_impl.h"
+#include "convert_kernels.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 
 namespace gr {
 namespace grnet {
 
-ComplexToInt16Bytes::sptr ComplexToInt16Bytes::make() {
-  return gnuradio::get_initial_sptr(new ComplexToInt16Bytes_impl());
+ComplexToInt16Bytes::sptr ComplexToInt16Bytes::make(bool bigEndian) {
+  return gnuradio::get_initial_sptr(new ComplexToInt16Bytes_impl(bigEndian));
 }
 
 /*
  * The private constructor
  */
-ComplexToInt16Bytes_impl::ComplexToInt16Bytes_impl()
+ComplexToInt16Bytes_impl::ComplexToInt16Bytes_impl(bool bigEndian)
     : gr::sync_interpolator("ComplexToInt16Bytes",
                             gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                            gr::io_signature::make(1, 1, sizeof(char)), 4) {
+                            gr::io_signature::make(1, 1, sizeof(char)), 4),
+      d_bigEndian(bigEndian) {
   const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
   set_alignment(std::max(1, alignment_multiple));
 }
@@ -714,7 +716,11 @@ int ComplexToInt16Bytes_impl::work(int noutput_items,
 
   // 4 bytes out for every 1 complex in, or 2 floats for every 4 bytes out.
   // So num floats = noutput_items/2
-  volk_32f_s32f_convert_16i(out, in, (float)SHRT_MAX, noutput_items / 2);
+  if (d_bigEndian)
+    convert_32f_to_16i(out, in, (float)SHRT_MAX, gr_complex(0, 0), true,
+                       noutput_items / 2);
+  else
+    volk_32f_s32f_convert_16i(out, in, (float)SHRT_MAX, noutput_items / 2);
 
   // Tell runtime system how many output items we produced.
   return noutput_items;
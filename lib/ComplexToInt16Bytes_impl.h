@@ -685,10 +685,10 @@ namespace grnet {
 
 class ComplexToInt16Bytes_impl : public ComplexToInt16Bytes {
 private:
-  // Nothing to declare in this block.
+  bool d_bigEndian;
 
 public:
-  ComplexToInt16Bytes_impl();
+  ComplexToInt16Bytes_impl(bool bigEndian);
   ~ComplexToInt16Bytes_impl();
 
   // Where all the action really happens
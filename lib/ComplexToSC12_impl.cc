@@ -0,0 +1,70 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "ComplexToSC12_impl.h"
+#include "convert_kernels.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+ComplexToSC12::sptr ComplexToSC12::make(float scale) {
+  return gnuradio::get_initial_sptr(new ComplexToSC12_impl(scale));
+}
+
+/*
+ * The private constructor
+ */
+ComplexToSC12_impl::ComplexToSC12_impl(float scale)
+    : gr::sync_interpolator("ComplexToSC12",
+                            gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                            gr::io_signature::make(1, 1, sizeof(char)), 3),
+      d_scale(scale), d_saturated(0) {
+  const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+  set_alignment(std::max(1, alignment_multiple));
+}
+
+/*
+ * Our virtual destructor.
+ */
+ComplexToSC12_impl::~ComplexToSC12_impl() {}
+
+int ComplexToSC12_impl::work(int noutput_items,
+                             gr_vector_const_void_star &input_items,
+                             gr_vector_void_star &output_items) {
+  const float *in = (const float *)input_items[0];
+  uint8_t *out = (uint8_t *)output_items[0];
+
+  // 3 bytes out for every complex in
+  uint64_t clipped =
+      convert_32f_to_sc12(out, in, d_scale, noutput_items / 3 * 2);
+  if (clipped)
+    d_saturated += clipped;
+
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
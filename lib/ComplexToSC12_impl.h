@@ -0,0 +1,50 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_COMPLEXTOSC12_IMPL_H
+#define INCLUDED_GRNET_COMPLEXTOSC12_IMPL_H
+
+#include <grnet/ComplexToSC12.h>
+
+#include <atomic>
+
+namespace gr {
+namespace grnet {
+
+class ComplexToSC12_impl : public ComplexToSC12 {
+private:
+  float d_scale;
+  std::atomic<uint64_t> d_saturated;
+
+public:
+  ComplexToSC12_impl(float scale);
+  ~ComplexToSC12_impl();
+
+  uint64_t saturated() const { return d_saturated.load(); }
+
+  // Where all the action really happens
+  int work(int noutput_items, gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_COMPLEXTOSC12_IMPL_H */
@@ -680,31 +680,47 @@
 #endif
 
 #include "ComplexToSC16_impl.h"
+#include "convert_kernels.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 
 namespace gr {
 namespace grnet {
 
-ComplexToSC16::sptr ComplexToSC16::make() {
-  return gnuradio::get_initial_sptr(new ComplexToSC16_impl());
+ComplexToSC16::sptr ComplexToSC16::make(bool bigEndian, float scale,
+                                         gr_complex offset, int nthreads) {
+  return gnuradio::get_initial_sptr(
+      new ComplexToSC16_impl(bigEndian, scale, offset, nthreads));
 }
 
 /*
  * The private constructor
  */
-ComplexToSC16_impl::ComplexToSC16_impl()
+ComplexToSC16_impl::ComplexToSC16_impl(bool bigEndian, float scale,
+                                       gr_complex offset, int nthreads)
     : gr::sync_interpolator("ComplexToSC16",
                             gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                            gr::io_signature::make(1, 1, sizeof(int16_t)), 2) {
+                            gr::io_signature::make(1, 1, sizeof(int16_t)), 2),
+      d_bigEndian(bigEndian), d_scale(scale), d_offset(offset),
+      d_saturated(0), d_pool(NULL) {
   const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
   set_alignment(std::max(1, alignment_multiple));
+
+  if (nthreads > 1) {
+    d_pool = new convert_thread_pool(nthreads);
+
+    // As in SC16ToComplex: work in whole pieces, with a buffer that
+    // holds a piece per thread twice over.
+    int piece = CONVERT_POOL_MIN_PIECE_BYTES / sizeof(short);
+    set_output_multiple(piece);
+    set_min_output_buffer(2 * nthreads * piece);
+  }
 }
 
 /*
  * Our virtual destructor.
  */
-ComplexToSC16_impl::~ComplexToSC16_impl() {}
+ComplexToSC16_impl::~ComplexToSC16_impl() { delete d_pool; }
 
 int ComplexToSC16_impl::work(int noutput_items,
                              gr_vector_const_void_star &input_items,
@@ -712,7 +728,23 @@ int ComplexToSC16_impl::work(int noutput_items,
   const float *in = (const float *)input_items[0];
   short *out = (short *)output_items[0];
 
-  volk_32f_s32f_convert_16i(out, in, (float)SHRT_MAX, noutput_items);
+  // begin and end are in shorts, and always even
+  auto convert = [&](size_t begin, size_t end) -> uint64_t {
+    return convert_32f_to_16i(out + begin, in + begin, d_scale, d_offset,
+                              d_bigEndian, end - begin);
+  };
+
+  // Pieces start on a cache line in the output
+  uint64_t clipped;
+  if (d_pool)
+    clipped = d_pool->run(noutput_items, 64 / sizeof(short),
+                          CONVERT_POOL_MIN_PIECE_BYTES / sizeof(short),
+                          convert);
+  else
+    clipped = convert(0, noutput_items);
+
+  if (clipped)
+    d_saturated += clipped;
 
   return noutput_items;
 }
@@ -680,17 +680,27 @@
 
 #include <grnet/ComplexToSC16.h>
 
+#include "convert_thread_pool.h"
+#include <atomic>
+
 namespace gr {
 namespace grnet {
 
 class ComplexToSC16_impl : public ComplexToSC16 {
 private:
-  // Nothing to declare in this block.
+  bool d_bigEndian;
+  float d_scale;
+  gr_complex d_offset;
+  std::atomic<uint64_t> d_saturated;
+  convert_thread_pool *d_pool; // NULL when single threaded
 
 public:
-  ComplexToSC16_impl();
+  ComplexToSC16_impl(bool bigEndian, float scale, gr_complex offset,
+                     int nthreads);
   ~ComplexToSC16_impl();
 
+  uint64_t saturated() const { return d_saturated.load(); }
+
   // Where all the action really happens
   int work(int noutput_items, gr_vector_const_void_star &input_items,
            gr_vector_void_star &output_items);
@@ -680,23 +680,26 @@
 #endif
 
 #include "ComplexToSigned8_impl.h"
+#include "convert_kernels.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 
 namespace gr {
 namespace grnet {
 
-ComplexToSigned8::sptr ComplexToSigned8::make() {
-  return gnuradio::get_initial_sptr(new ComplexToSigned8_impl());
+ComplexToSigned8::sptr ComplexToSigned8::make(float scale,
+                                               gr_complex offset) {
+  return gnuradio::get_initial_sptr(new ComplexToSigned8_impl(scale, offset));
 }
 
 /*
  * The private constructor
  */
-ComplexToSigned8_impl::ComplexToSigned8_impl()
+ComplexToSigned8_impl::ComplexToSigned8_impl(float scale, gr_complex offset)
     : gr::sync_interpolator("ComplexToSigned8",
                             gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                            gr::io_signature::make(1, 1, sizeof(char)), 2) {
+                            gr::io_signature::make(1, 1, sizeof(char)), 2),
+      d_scale(scale), d_offset(offset), d_saturated(0) {
   const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
   set_alignment(std::max(1, alignment_multiple));
 }
@@ -712,7 +715,10 @@ int ComplexToSigned8_impl::work(int noutput_items,
   const float *in = (const float *)input_items[0];
   int8_t *out = (int8_t *)output_items[0];
 
-  volk_32f_s32f_convert_8i(out, in, (float)SCHAR_MAX, noutput_items);
+  uint64_t clipped =
+      convert_32f_to_8i(out, in, d_scale, d_offset, noutput_items);
+  if (clipped)
+    d_saturated += clipped;
 
   // Tell runtime system how many output items we produced.
   return noutput_items;
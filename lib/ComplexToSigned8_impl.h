@@ -680,17 +680,23 @@
 
 #include <grnet/ComplexToSigned8.h>
 
+#include <atomic>
+
 namespace gr {
 namespace grnet {
 
 class ComplexToSigned8_impl : public ComplexToSigned8 {
 private:
-  // Nothing to declare in this block.
+  float d_scale;
+  gr_complex d_offset;
+  std::atomic<uint64_t> d_saturated;
 
 public:
-  ComplexToSigned8_impl();
+  ComplexToSigned8_impl(float scale, gr_complex offset);
   ~ComplexToSigned8_impl();
 
+  uint64_t saturated() const { return d_saturated.load(); }
+
   // Where all the action really happens
   int work(int noutput_items, gr_vector_const_void_star &input_items,
            gr_vector_void_star &output_items);
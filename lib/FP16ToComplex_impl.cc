@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "FP16ToComplex_impl.h"
+#include "convert_kernels.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+FP16ToComplex::sptr FP16ToComplex::make(bool bfloat16,
+                                        size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new FP16ToComplex_impl(bfloat16, nontemporalThreshold));
+}
+
+/*
+ * The private constructor
+ */
+FP16ToComplex_impl::FP16ToComplex_impl(bool bfloat16,
+                                       size_t nontemporalThreshold)
+    : gr::sync_decimator("FP16ToComplex",
+                         gr::io_signature::make(1, 1, sizeof(int16_t)),
+                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 2),
+      d_bfloat16(bfloat16), d_nontemporalThreshold(nontemporalThreshold) {
+  const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+  set_alignment(std::max(1, alignment_multiple));
+}
+
+/*
+ * Our virtual destructor.
+ */
+FP16ToComplex_impl::~FP16ToComplex_impl() {}
+
+int FP16ToComplex_impl::work(int noutput_items,
+                             gr_vector_const_void_star &input_items,
+                             gr_vector_void_star &output_items) {
+  const int16_t *in = (const int16_t *)input_items[0];
+  float *out = (float *)output_items[0];
+
+  bool nontemporal =
+      d_nontemporalThreshold &&
+      noutput_items * sizeof(gr_complex) >= d_nontemporalThreshold;
+
+  auto convert = [&](float *dst, size_t begin, size_t n) {
+    convert_16f_to_32f(dst, (const uint16_t *)in + begin, d_bfloat16, n);
+  };
+  convert_32f_output(out, 0, 2 * noutput_items, nontemporal, convert);
+
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
@@ -680,23 +680,28 @@
 #endif
 
 #include "Int16BytesToComplex_impl.h"
+#include "convert_kernels.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 
 namespace gr {
 namespace grnet {
 
-Int16BytesToComplex::sptr Int16BytesToComplex::make() {
-  return gnuradio::get_initial_sptr(new Int16BytesToComplex_impl());
+Int16BytesToComplex::sptr
+Int16BytesToComplex::make(bool bigEndian, size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new Int16BytesToComplex_impl(bigEndian, nontemporalThreshold));
 }
 
 /*
  * The private constructor
  */
-Int16BytesToComplex_impl::Int16BytesToComplex_impl()
+Int16BytesToComplex_impl::Int16BytesToComplex_impl(bool bigEndian,
+                                                   size_t nontemporalThreshold)
     : gr::sync_decimator("Int16BytesToComplex",
                          gr::io_signature::make(1, 1, sizeof(char)),
-                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 4) {
+                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 4),
+      d_bigEndian(bigEndian), d_nontemporalThreshold(nontemporalThreshold) {
   const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
   set_alignment(std::max(1, alignment_multiple));
 }
@@ -712,8 +717,19 @@ int Int16BytesToComplex_impl::work(int noutput_items,
   const short *in = (const short *)input_items[0];
   float *out = (float *)output_items[0];
 
+  bool nontemporal =
+      d_nontemporalThreshold &&
+      noutput_items * sizeof(gr_complex) >= d_nontemporalThreshold;
+
+  auto convert = [&](float *dst, size_t begin, size_t n) {
+    if (d_bigEndian)
+      convert_16i_be_to_32f(dst, in + begin, (float)SHRT_MAX, n);
+    else
+      volk_16i_s32f_convert_32f(dst, in + begin, (float)SHRT_MAX, n);
+  };
+
   // Outputs are complex, so num floats = noutput_items*2
-  volk_16i_s32f_convert_32f(out, in, (float)SHRT_MAX, 2 * noutput_items);
+  convert_32f_output(out, 0, 2 * noutput_items, nontemporal, convert);
 
   return noutput_items;
 }
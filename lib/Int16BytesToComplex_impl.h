@@ -685,10 +685,11 @@ namespace grnet {
 
 class Int16BytesToComplex_impl : public Int16BytesToComplex {
 private:
-  // Nothing to declare in this block.
+  bool d_bigEndian;
+  size_t d_nontemporalThreshold;
 
 public:
-  Int16BytesToComplex_impl();
+  Int16BytesToComplex_impl(bool bigEndian, size_t nontemporalThreshold);
   ~Int16BytesToComplex_impl();
 
   // Where all the action really happens
@@ -0,0 +1,90 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "IntComplexFIRDecimator_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace grnet {
+
+IntComplexFIRDecimator::sptr
+IntComplexFIRDecimator::make(size_t itemsize, int decimation,
+                             const std::vector<float> &taps) {
+  return gnuradio::get_initial_sptr(
+      new IntComplexFIRDecimator_impl(itemsize, decimation, taps));
+}
+
+/*
+ * The private constructor
+ */
+IntComplexFIRDecimator_impl::IntComplexFIRDecimator_impl(
+    size_t itemsize, int decimation, const std::vector<float> &taps)
+    : gr::sync_decimator("IntComplexFIRDecimator",
+                         gr::io_signature::make(1, 1, itemsize),
+                         gr::io_signature::make(1, 1, itemsize), decimation),
+      d_itemsize(itemsize), d_fir(NULL) {
+  if (itemsize != 1 && itemsize != 2)
+    throw std::runtime_error(
+        "[Int Complex FIR Decimator] Item size must be 1 (int8) or 2 (int16).");
+
+  if (decimation < 1)
+    throw std::runtime_error(
+        "[Int Complex FIR Decimator] Decimation must be at least 1.");
+
+  if (taps.empty())
+    throw std::runtime_error("[Int Complex FIR Decimator] No filter taps.");
+
+  if (int_fir_decimator::tap_shift(taps, 8 * itemsize) < 0)
+    throw std::runtime_error("[Int Complex FIR Decimator] Filter taps are "
+                             "too large to represent in 16 bits.");
+
+  d_fir = new int_fir_decimator(decimation, taps, 8 * itemsize);
+
+  // Items are I and Q individually, so the history is two per tap and
+  // outputs come in pairs.
+  set_history(2 * (d_fir->ntaps() - 1) + 1);
+  gr::block::set_output_multiple(2);
+}
+
+/*
+ * Our virtual destructor.
+ */
+IntComplexFIRDecimator_impl::~IntComplexFIRDecimator_impl() { delete d_fir; }
+
+int IntComplexFIRDecimator_impl::work(int noutput_items,
+                                      gr_vector_const_void_star &input_items,
+                                      gr_vector_void_star &output_items) {
+  if (d_itemsize == 1)
+    d_fir->filter((int8_t *)output_items[0], (const int8_t *)input_items[0],
+                  noutput_items / 2);
+  else
+    d_fir->filter((int16_t *)output_items[0],
+                  (const int16_t *)input_items[0], noutput_items / 2);
+
+  // Tell runtime system how many output items we produced.
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
@@ -0,0 +1,481 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "PCAPUDPSink_impl.h"
+#include <gnuradio/io_signature.h>
+#include <grnet/udpHeaderTypes.h>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <sstream>
+
+// Nanosecond-resolution classic pcap, Ethernet link type
+#define PCAP_MAGIC_NS 0xa1b23c4d
+#define PCAP_SNAPLEN 262144
+#define PCAP_LINKTYPE_ETHERNET 1
+#define PCAP_RECORD_HEADER_SIZE 16
+
+// Synthetic addressing: locally administered MACs, 10.0.0.1 -> 10.0.0.2
+static const uint8_t SRC_MAC[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+static const uint8_t DST_MAC[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x02};
+#define SRC_IP 0x0A000001
+#define DST_IP 0x0A000002
+
+namespace gr {
+namespace grnet {
+
+PCAPUDPSink::sptr PCAPUDPSink::make(size_t itemsize, size_t vecLen,
+                                    const std::string &filename, int port,
+                                    int headerType, int payloadsize,
+                                    double sampleRate, bool useRxTime,
+                                    bool directIO) {
+  return gnuradio::get_initial_sptr(
+      new PCAPUDPSink_impl(itemsize, vecLen, filename, port, headerType,
+                           payloadsize, sampleRate, useRxTime, directIO));
+}
+
+static inline uint64_t realtime_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline void wr16be(char *p, uint16_t v) {
+  v = htons(v);
+  memcpy(p, &v, sizeof(v));
+}
+
+static inline void wr32be(char *p, uint32_t v) {
+  v = htonl(v);
+  memcpy(p, &v, sizeof(v));
+}
+
+/*
+ * The private constructor
+ */
+PCAPUDPSink_impl::PCAPUDPSink_impl(size_t itemsize, size_t vecLen,
+                                   const std::string &filename, int port,
+                                   int headerType, int payloadsize,
+                                   double sampleRate, bool useRxTime,
+                                   bool directIO)
+    : gr::sync_block("PCAPUDPSink",
+                     gr::io_signature::make(1, 1, itemsize * vecLen),
+                     gr::io_signature::make(0, 0, 0)),
+      d_itemsize(itemsize), d_veclen(vecLen), d_port(port),
+      d_header_type(headerType), d_header_size(0), d_payloadsize(payloadsize),
+      d_seq_num(0), d_filename(filename), d_direct_io(directIO), d_fd(-1),
+      d_buffer(NULL), d_buffer_used(0), d_ip_id(0), d_ip_checksum_base(0),
+      d_pending(NULL), d_pending_bytes(0), d_pending_item(0),
+      d_sample_rate(sampleRate), d_use_rx_time(useRxTime), d_time_set(false),
+      d_time_base_ns(0), d_time_base_item(0), d_packets_written(0),
+      d_bytes_written(0) {
+  switch (d_header_type) {
+  case HEADERTYPE_SEQNUM:
+    d_header_size = sizeof(HeaderSeqNum);
+    break;
+
+  case HEADERTYPE_SEQPLUSSIZE:
+    d_header_size = sizeof(HeaderSeqPlusSize);
+    break;
+
+  case HEADERTYPE_CHDR:
+    d_header_size = sizeof(CHDR);
+    break;
+
+  case HEADERTYPE_NONE:
+    d_header_size = 0;
+    break;
+
+  default:
+    GR_LOG_ERROR(d_logger, "Unknown header type.");
+    throw std::runtime_error("[PCAP UDP Sink] Unknown header type");
+    break;
+  }
+
+  // The payload has to fit in one (unfragmented) IPv4 datagram.
+  if (payloadsize < 8 || payloadsize > 65535 - PCAPUDPSINK_IPV4_BYTES -
+                                           PCAPUDPSINK_UDP_BYTES) {
+    GR_LOG_ERROR(d_logger, "Payload size must be between 8 and 65507 bytes.");
+    throw std::runtime_error("[PCAP UDP Sink] Invalid payload size.");
+  }
+
+  if (port < 0 || port > 65535)
+    throw std::runtime_error("[PCAP UDP Sink] Invalid port number.");
+
+  if (d_sample_rate < 0.0)
+    throw std::runtime_error("[PCAP UDP Sink] Sample rate can't be "
+                             "negative.");
+
+  d_block_size = d_itemsize * d_veclen;
+  d_precomp_datasize = d_payloadsize - d_header_size;
+  d_rx_time_key = pmt::mp("rx_time");
+
+  void *buffer;
+
+  if (posix_memalign(&buffer, PCAPUDPSINK_ALIGNMENT, PCAPUDPSINK_BUFFER_BYTES))
+    throw std::bad_alloc();
+
+  d_buffer = (char *)buffer;
+  d_pending = new char[d_precomp_datasize];
+
+  // Fixed parts of the per-packet headers
+  memset(d_frame_header, 0, sizeof(d_frame_header));
+
+  uint32_t udpLen = PCAPUDPSINK_UDP_BYTES + d_payloadsize;
+  uint32_t ipLen = PCAPUDPSINK_IPV4_BYTES + udpLen;
+  uint32_t frameLen = PCAPUDPSINK_ETH_BYTES + ipLen;
+
+  char *rec = d_frame_header;
+  memcpy(&rec[8], &frameLen, sizeof(frameLen)); // incl_len
+  memcpy(&rec[12], &frameLen, sizeof(frameLen)); // orig_len
+
+  char *eth = &rec[PCAP_RECORD_HEADER_SIZE];
+  memcpy(&eth[0], DST_MAC, 6);
+  memcpy(&eth[6], SRC_MAC, 6);
+  wr16be(&eth[12], 0x0800);
+
+  char *ip = &eth[PCAPUDPSINK_ETH_BYTES];
+  ip[0] = 0x45;
+  wr16be(&ip[2], ipLen);
+  wr16be(&ip[6], 0x4000); // Don't fragment
+  ip[8] = 64;             // TTL
+  ip[9] = 17;             // UDP
+  wr32be(&ip[12], SRC_IP);
+  wr32be(&ip[16], DST_IP);
+
+  // Header checksum over everything but the id, which changes per packet
+  for (int i = 0; i < PCAPUDPSINK_IPV4_BYTES; i += 2)
+    d_ip_checksum_base += ((uint8_t)ip[i] << 8) | (uint8_t)ip[i + 1];
+
+  char *udp = &ip[PCAPUDPSINK_IPV4_BYTES];
+  wr16be(&udp[0], d_port);
+  wr16be(&udp[2], d_port);
+  wr16be(&udp[4], udpLen);
+  // UDP checksum is optional over IPv4; left at 0.
+
+  d_frame_header_size =
+      PCAP_RECORD_HEADER_SIZE + PCAPUDPSINK_FRAME_OVERHEAD + d_header_size;
+
+  openFile();
+
+  // Keep packets aligned with the item boundaries where possible.
+  int outMultiple = d_precomp_datasize / d_block_size;
+
+  if (outMultiple > 1 && (d_precomp_datasize % d_block_size) == 0)
+    gr::block::set_output_multiple(outMultiple);
+}
+
+/*
+ * Our virtual destructor.
+ */
+PCAPUDPSink_impl::~PCAPUDPSink_impl() {
+  stop();
+
+  if (d_buffer) {
+    free(d_buffer);
+    d_buffer = NULL;
+  }
+
+  if (d_pending) {
+    delete[] d_pending;
+    d_pending = NULL;
+  }
+}
+
+void PCAPUDPSink_impl::openFile() {
+  int flags = O_WRONLY | O_CREAT | O_TRUNC;
+
+  if (d_direct_io) {
+    d_fd = ::open(d_filename.c_str(), flags | O_DIRECT, 0644);
+
+    if (d_fd < 0 && errno == EINVAL) {
+      // tmpfs and some network filesystems don't do O_DIRECT
+      GR_LOG_WARN(d_logger, "[PCAP UDP Sink] O_DIRECT isn't supported for " +
+                                d_filename + ".  Using buffered writes.");
+      d_direct_io = false;
+    }
+  }
+
+  if (!d_direct_io)
+    d_fd = ::open(d_filename.c_str(), flags, 0644);
+
+  if (d_fd < 0) {
+    std::string err = strerror(errno);
+    GR_LOG_ERROR(d_logger, "Unable to open " + d_filename + ": " + err);
+    throw std::runtime_error("[PCAP UDP Sink] Unable to open " + d_filename +
+                             ": " + err);
+  }
+
+  // pcap file header, host byte order
+  char header[24];
+  uint32_t magic = PCAP_MAGIC_NS;
+  uint16_t versionMajor = 2;
+  uint16_t versionMinor = 4;
+  int32_t thiszone = 0;
+  uint32_t sigfigs = 0;
+  uint32_t snaplen = PCAP_SNAPLEN;
+  uint32_t linktype = PCAP_LINKTYPE_ETHERNET;
+
+  memcpy(&header[0], &magic, 4);
+  memcpy(&header[4], &versionMajor, 2);
+  memcpy(&header[6], &versionMinor, 2);
+  memcpy(&header[8], &thiszone, 4);
+  memcpy(&header[12], &sigfigs, 4);
+  memcpy(&header[16], &snaplen, 4);
+  memcpy(&header[20], &linktype, 4);
+
+  append(header, sizeof(header));
+  d_bytes_written += sizeof(header);
+}
+
+void PCAPUDPSink_impl::closeFile() {
+  if (d_fd < 0)
+    return;
+
+  flush(true);
+
+  ::close(d_fd);
+  d_fd = -1;
+}
+
+void PCAPUDPSink_impl::append(const char *data, size_t len) {
+  while (len > 0) {
+    size_t n = std::min(len, (size_t)PCAPUDPSINK_BUFFER_BYTES - d_buffer_used);
+
+    memcpy(&d_buffer[d_buffer_used], data, n);
+    d_buffer_used += n;
+    data += n;
+    len -= n;
+
+    if (d_buffer_used == PCAPUDPSINK_BUFFER_BYTES)
+      flush(false);
+  }
+}
+
+void PCAPUDPSink_impl::flush(bool final) {
+  // Only ever called with a full buffer until the end, so O_DIRECT writes
+  // are always whole aligned blocks.  The tail at close is the exception:
+  // write what's aligned, then drop O_DIRECT for the rest.
+  size_t len = d_buffer_used;
+  size_t offset = 0;
+
+  while (offset < len) {
+    size_t chunk = len - offset;
+
+    if (d_direct_io && final) {
+      size_t aligned = chunk & ~((size_t)PCAPUDPSINK_ALIGNMENT - 1);
+
+      if (aligned == 0) {
+        fcntl(d_fd, F_SETFL, fcntl(d_fd, F_GETFL) & ~O_DIRECT);
+        d_direct_io = false;
+      } else
+        chunk = aligned;
+    }
+
+    ssize_t written = ::write(d_fd, &d_buffer[offset], chunk);
+
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+
+      std::string err = strerror(errno);
+      GR_LOG_ERROR(d_logger, "Error writing " + d_filename + ": " + err);
+      throw std::runtime_error("[PCAP UDP Sink] Error writing file: " + err);
+    }
+
+    offset += written;
+  }
+
+  d_buffer_used = 0;
+}
+
+void PCAPUDPSink_impl::buildHeader(uint64_t ts_ns) {
+  char *rec = d_frame_header;
+  uint32_t tsSec = ts_ns / 1000000000ULL;
+  uint32_t tsNsec = ts_ns % 1000000000ULL;
+  memcpy(&rec[0], &tsSec, sizeof(tsSec));
+  memcpy(&rec[4], &tsNsec, sizeof(tsNsec));
+
+  char *ip = &rec[PCAP_RECORD_HEADER_SIZE + PCAPUDPSINK_ETH_BYTES];
+  d_ip_id++;
+
+  uint32_t sum = d_ip_checksum_base + d_ip_id;
+  sum = (sum & 0xFFFF) + (sum >> 16);
+  sum = (sum & 0xFFFF) + (sum >> 16);
+
+  wr16be(&ip[4], d_ip_id);
+  wr16be(&ip[10], ~sum & 0xFFFF);
+
+  // Same headers as the UDP sink
+  char *hdr = &rec[PCAP_RECORD_HEADER_SIZE + PCAPUDPSINK_FRAME_OVERHEAD];
+
+  switch (d_header_type) {
+  case HEADERTYPE_SEQNUM: {
+    d_seq_num++;
+    HeaderSeqNum seqHeader;
+    seqHeader.seqnum = d_seq_num;
+    memcpy(hdr, (void *)&seqHeader, d_header_size);
+  } break;
+
+  case HEADERTYPE_SEQPLUSSIZE: {
+    d_seq_num++;
+    HeaderSeqPlusSize seqHeaderPlusSize;
+    seqHeaderPlusSize.seqnum = d_seq_num;
+    seqHeaderPlusSize.length = d_payloadsize;
+    memcpy(hdr, (void *)&seqHeaderPlusSize, d_header_size);
+  } break;
+
+  case HEADERTYPE_CHDR: {
+    d_seq_num++;
+
+    // Rollover at 12-bits
+    if (d_seq_num > 0x0FFF)
+      d_seq_num = 1;
+
+    CHDR chdr;
+    chdr.sid = d_port;
+    chdr.length = d_payloadsize;
+    chdr.seqPlusFlags = d_seq_num; // For now set all other flags to zero.
+    memcpy(hdr, (void *)&chdr, d_header_size);
+  } break;
+  }
+}
+
+uint64_t PCAPUDPSink_impl::packetTime(uint64_t item) {
+  if (d_sample_rate <= 0.0)
+    return realtime_ns();
+
+  if (!d_time_set) {
+    d_time_base_ns = realtime_ns();
+    d_time_base_item = item;
+    d_time_set = true;
+  }
+
+  // Signed: a packet can start just before the rx_time tag that set the
+  // base.
+  double offset =
+      (double)((int64_t)(item - d_time_base_item)) / d_sample_rate * 1e9;
+
+  return d_time_base_ns + (int64_t)offset;
+}
+
+void PCAPUDPSink_impl::applyTimeTag(const gr::tag_t &tag) {
+  const pmt::pmt_t &value = tag.value;
+
+  if (!pmt::is_tuple(value) || pmt::length(value) != 2)
+    return;
+
+  uint64_t secs = pmt::to_uint64(pmt::tuple_ref(value, 0));
+  double frac = pmt::to_double(pmt::tuple_ref(value, 1));
+
+  d_time_base_ns = secs * 1000000000ULL + (uint64_t)(frac * 1e9 + 0.5);
+  d_time_base_item = tag.offset;
+  d_time_set = true;
+}
+
+void PCAPUDPSink_impl::writePacket(const char *data, uint64_t item) {
+  buildHeader(packetTime(item));
+
+  append(d_frame_header, d_frame_header_size);
+  append(data, d_precomp_datasize);
+
+  d_packets_written++;
+  d_bytes_written += d_frame_header_size + d_precomp_datasize;
+}
+
+bool PCAPUDPSink_impl::stop() {
+  gr::thread::scoped_lock guard(d_setlock);
+
+  closeFile();
+
+  return true;
+}
+
+int PCAPUDPSink_impl::work(int noutput_items,
+                           gr_vector_const_void_star &input_items,
+                           gr_vector_void_star &output_items) {
+  gr::thread::scoped_lock guard(d_setlock);
+
+  const char *in = (const char *)input_items[0];
+  size_t numBytes = noutput_items * d_block_size;
+  uint64_t firstItem = nitems_read(0);
+
+  std::vector<gr::tag_t> tags;
+  size_t nextTag = 0;
+
+  if (d_use_rx_time && d_sample_rate > 0.0)
+    get_tags_in_range(tags, 0, firstItem, firstItem + noutput_items,
+                      d_rx_time_key);
+
+  size_t pos = 0;
+
+  while (pos < numBytes) {
+    uint64_t item = firstItem + pos / d_block_size;
+
+    if (d_pending_bytes == 0 && numBytes - pos >= (size_t)d_precomp_datasize) {
+      // Whole packet in the input: write it straight from there.
+      while (nextTag < tags.size() && tags[nextTag].offset <= item)
+        applyTimeTag(tags[nextTag++]);
+
+      writePacket(&in[pos], item);
+      pos += d_precomp_datasize;
+      continue;
+    }
+
+    // Packet straddles work() calls.  Collect it in d_pending.
+    if (d_pending_bytes == 0)
+      d_pending_item = item;
+
+    size_t n = std::min((size_t)(d_precomp_datasize - d_pending_bytes),
+                        numBytes - pos);
+
+    memcpy(&d_pending[d_pending_bytes], &in[pos], n);
+    d_pending_bytes += n;
+    pos += n;
+
+    if (d_pending_bytes == d_precomp_datasize) {
+      while (nextTag < tags.size() && tags[nextTag].offset <= d_pending_item)
+        applyTimeTag(tags[nextTag++]);
+
+      writePacket(d_pending, d_pending_item);
+      d_pending_bytes = 0;
+    }
+  }
+
+  // Tags past the start of the last packet still set the timeline for the
+  // packets that follow.
+  while (nextTag < tags.size())
+    applyTimeTag(tags[nextTag++]);
+
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
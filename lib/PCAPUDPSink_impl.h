@@ -0,0 +1,119 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_PCAPUDPSINK_IMPL_H
+#define INCLUDED_GRNET_PCAPUDPSINK_IMPL_H
+
+#include <grnet/PCAPUDPSink.h>
+
+#include "packet_headers.h"
+#include <atomic>
+
+// Staging buffer.  Written out whole (so O_DIRECT writes stay aligned) and
+// page aligned.
+#define PCAPUDPSINK_BUFFER_BYTES (8 * 1024 * 1024)
+#define PCAPUDPSINK_ALIGNMENT 4096
+
+// Synthetic link/network headers in front of every payload
+#define PCAPUDPSINK_ETH_BYTES 14
+#define PCAPUDPSINK_IPV4_BYTES 20
+#define PCAPUDPSINK_UDP_BYTES 8
+#define PCAPUDPSINK_FRAME_OVERHEAD                                             \
+  (PCAPUDPSINK_ETH_BYTES + PCAPUDPSINK_IPV4_BYTES + PCAPUDPSINK_UDP_BYTES)
+
+namespace gr {
+namespace grnet {
+
+class PCAPUDPSink_impl : public PCAPUDPSink {
+private:
+  size_t d_itemsize;
+  size_t d_veclen;
+  size_t d_block_size;
+
+  int d_port;
+  int d_header_type;
+  int d_header_size;
+  uint16_t d_payloadsize;
+  uint64_t d_seq_num;
+
+  int d_precomp_datasize;
+
+  std::string d_filename;
+  bool d_direct_io;
+  int d_fd;
+
+  // Staging buffer and how much of it is filled
+  char *d_buffer;
+  size_t d_buffer_used;
+
+  // Record header + Ethernet/IPv4/UDP + grnet header for the next packet.
+  // Everything but the sequence number, IP id/checksum and timestamp is
+  // the same for every packet, so it's filled in once.
+  char d_frame_header[16 + PCAPUDPSINK_FRAME_OVERHEAD + 16];
+  size_t d_frame_header_size;
+  uint16_t d_ip_id;
+  uint32_t d_ip_checksum_base;
+
+  // Data bytes of a packet not completed by the last work() call
+  char *d_pending;
+  int d_pending_bytes;
+  uint64_t d_pending_item; // Input item the pending packet starts at
+
+  // Timestamps: time_ns = d_time_base_ns + (item - d_time_base_item) /
+  // d_sample_rate
+  double d_sample_rate;
+  bool d_use_rx_time;
+  bool d_time_set;
+  uint64_t d_time_base_ns;
+  uint64_t d_time_base_item;
+  pmt::pmt_t d_rx_time_key;
+
+  std::atomic<uint64_t> d_packets_written;
+  std::atomic<uint64_t> d_bytes_written;
+
+  void openFile();
+  void closeFile();
+  void append(const char *data, size_t len);
+  void flush(bool final);
+
+  void buildHeader(uint64_t ts_ns);
+  void writePacket(const char *data, uint64_t item);
+  uint64_t packetTime(uint64_t item);
+  void applyTimeTag(const gr::tag_t &tag);
+
+public:
+  PCAPUDPSink_impl(size_t itemsize, size_t vecLen, const std::string &filename,
+                   int port, int headerType, int payloadsize,
+                   double sampleRate, bool useRxTime, bool directIO);
+  ~PCAPUDPSink_impl();
+
+  bool stop();
+
+  uint64_t packets_written() const { return d_packets_written.load(); }
+  uint64_t bytes_written() const { return d_bytes_written.load(); }
+
+  int work(int noutput_items, gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_PCAPUDPSINK_IMPL_H */
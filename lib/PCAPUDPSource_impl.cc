@@ -25,11 +25,8 @@
 #include "PCAPUDPSource_impl.h"
 #include <gnuradio/io_signature.h>
 
-#include <net/ethernet.h>
-#include <net/if.h>
-#include <netinet/ip.h>
-#include <netinet/udp.h>
 #include <sstream>
+#include <time.h>
 #include <unistd.h>
 
 namespace gr {
@@ -38,9 +35,32 @@ namespace grnet {
 PCAPUDPSource::sptr PCAPUDPSource::make(size_t itemsize, int port,
                                         int headerType, int payloadsize,
                                         bool notifyMissed, const char *filename,
-                                        bool repeat) {
+                                        bool repeat, double rate,
+                                        bool tagCaptureTime, double startTime,
+                                        double duration,
+                                        const std::vector<int> &additionalPorts,
+                                        int preloadMB) {
   return gnuradio::get_initial_sptr(new PCAPUDPSource_impl(
-      itemsize, port, headerType, payloadsize, notifyMissed, filename, repeat));
+      itemsize, port, headerType, payloadsize, notifyMissed, filename, repeat,
+      rate, tagCaptureTime, startTime, duration, additionalPorts, preloadMB));
+}
+
+std::string PCAPUDPSource::build_index(const std::string &filename,
+                                       double interval) {
+  if (interval <= 0.0)
+    throw std::runtime_error("[PCAP UDP Source] Index interval must be "
+                             "greater than 0.");
+
+  pcap_index index;
+  std::string sidecar = pcap_index::sidecar_name(filename);
+  std::string err;
+
+  if (!index.build(filename, err,
+                   (uint64_t)(interval * 1000000000.0 + 0.5)) ||
+      !index.save(sidecar, err))
+    throw std::runtime_error("[PCAP UDP Source] " + err);
+
+  return sidecar;
 }
 
 /*
@@ -49,9 +69,22 @@ PCAPUDPSource::sptr PCAPUDPSource::make(size_t itemsize, int port,
 PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
                                        int headerType, int payloadsize,
                                        bool notifyMissed, const char *filename,
-                                       bool repeat)
-    : gr::sync_block("PCAPUDPSource", gr::io_signature::make(0, 0, 0),
-                     gr::io_signature::make(1, 1, itemsize)) {
+                                       bool repeat, double rate,
+                                       bool tagCaptureTime, double startTime,
+                                       double duration,
+                                       const std::vector<int> &additionalPorts,
+                                       int preloadMB)
+    : gr::block("PCAPUDPSource", gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(1 + additionalPorts.size(),
+                                       1 + additionalPorts.size(), itemsize)),
+      d_start_time(startTime), d_duration(duration), d_window_start_ts(0),
+      d_window_end_ts(0), d_have_seek_pos(false),
+      d_preload_budget((size_t)std::max(preloadMB, 0) * 1024 * 1024),
+      d_preloading(false), d_preloaded(false), d_rate(rate), d_pace_start(0), d_pace_first_ts(0), d_pace_count(0),
+      d_pace_error_sum_ns(0), d_pace_error_max_ns(0) {
+  d_tag_capture_time = tagCaptureTime;
+  d_capture_time_key = pmt::mp("capture_time");
+
   d_itemsize = itemsize;
   d_veclen = 1;
   d_filename = filename;
@@ -59,7 +92,6 @@ PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
 
   d_block_size = d_itemsize * d_veclen;
   d_port = port;
-  d_seq_num = 0;
   d_notifyMissed = notifyMissed;
   d_header_type = headerType;
   ;
@@ -94,6 +126,14 @@ PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
     break;
   }
 
+  if (d_rate < 0.0)
+    throw std::runtime_error("[PCAP UDP Source] Playback rate can't be "
+                             "negative.  Use 0 for unlimited.");
+
+  if (d_start_time < 0.0 || d_duration < 0.0)
+    throw std::runtime_error("[PCAP UDP Source] Start time and duration "
+                             "can't be negative.");
+
   if (d_payloadsize < 8) {
     GR_LOG_ERROR(d_logger,
                  "Payload size is too small.  Must be at "
@@ -105,7 +145,39 @@ PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
   d_precompDataSize = d_payloadsize - d_header_size;
   d_precompDataOverItemSize = d_precompDataSize / d_itemsize;
 
-  localBuffer = new unsigned char[d_payloadsize];
+  // One flow per output, all served by the one pass through the file.
+  std::vector<int> ports(1, port);
+  ports.insert(ports.end(), additionalPorts.begin(), additionalPorts.end());
+
+  d_port_flow.assign(65536, -1);
+
+  for (size_t i = 0; i < ports.size(); i++) {
+    if (ports[i] < 0 || ports[i] > 65535)
+      throw std::runtime_error("[PCAP UDP Source] Invalid port number.");
+
+    if (d_port_flow[ports[i]] >= 0)
+      throw std::runtime_error("[PCAP UDP Source] Each port can only be "
+                               "listed once.");
+
+    flow f;
+    f.port = ports[i];
+    f.ring = NULL;
+    f.localBuffer = NULL;
+    f.partial_bytes = 0;
+    f.packet_offset = 0;
+    f.partial_ts = 0;
+    f.seq_num = 0;
+    f.matchingPackets = 0;
+
+    d_port_flow[f.port] = i;
+    d_flows.push_back(f);
+  }
+
+  for (size_t i = 0; i < d_flows.size(); i++) {
+    d_flows[i].localBuffer = new unsigned char[d_payloadsize];
+    d_flows[i].ring =
+        new packet_ring(PCAPUDPSOURCE_RING_BYTES, PCAPUDPSOURCE_RING_PACKETS);
+  }
 
   int outMultiple = (d_payloadsize - d_header_size) / d_block_size;
 
@@ -120,6 +192,9 @@ PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
 
   threadRunning = false;
   stopThread = false;
+  d_readerWaiting = false;
+  d_workWaiting = false;
+  d_endOfFile = false;
 
   if (FILE *file = fopen(d_filename.c_str(), "r")) {
     fclose(file);
@@ -129,8 +204,6 @@ PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
     return;
   }
 
-  pcapFile = NULL;
-
   readThread =
       new boost::thread(boost::bind(&PCAPUDPSource_impl::runThread, this));
 }
@@ -140,97 +213,337 @@ PCAPUDPSource_impl::PCAPUDPSource_impl(size_t itemsize, int port,
  */
 PCAPUDPSource_impl::~PCAPUDPSource_impl() { stop(); }
 
-void PCAPUDPSource_impl::runThread() {
-  threadRunning = true;
-  int maxQueueSize = 64000;
+static inline uint64_t monotonic_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
 
-  int sizeUDPHeader = sizeof(struct udphdr);
-  pcap_pkthdr header;
-  const u_char *p;
-  timeval tv;
-  unsigned long matchingPackets;
+void PCAPUDPSource_impl::pacePacket(uint64_t ts_ns) {
+  if (d_rate == 0.0)
+    return; // Unlimited
 
-  while (!stopThread) {
-    tv = {0, 0};
-    restart();
-    matchingPackets = 0;
+  uint64_t now = monotonic_ns();
 
-    while ((p = pcap_next(pcapFile, &header))) {
-      if (header.len != header.caplen) {
-        continue;
-      }
-      auto eth = reinterpret_cast<const ether_header *>(p);
+  if (d_pace_start == 0) {
+    // First packet of this pass anchors the schedule.
+    d_pace_start = now;
+    d_pace_first_ts = ts_ns;
+    return;
+  }
 
-      // jump over and ignore vlan tag
-      if (ntohs(eth->ether_type) == ETHERTYPE_VLAN) {
-        p += 4;
-        eth = reinterpret_cast<const ether_header *>(p);
-      }
-      if (ntohs(eth->ether_type) != ETHERTYPE_IP) {
-        continue;
-      }
-      auto ip = reinterpret_cast<const struct ip *>(p + sizeof(ether_header));
-      if (ip->ip_v != 4) {
-        continue;
-      }
-      if (ip->ip_p != IPPROTO_UDP) {
-        continue;
-      }
+  // Out of order timestamps are released immediately.
+  uint64_t offset = (ts_ns > d_pace_first_ts) ? ts_ns - d_pace_first_ts : 0;
+  uint64_t due = d_pace_start + (uint64_t)((double)offset / d_rate);
+
+  // Sleep to just short of the deadline against the absolute schedule, so
+  // oversleeping on one packet doesn't push back all the ones after it,
+  // then spin the rest.  Long gaps are slept in slices so stop() isn't held
+  // up.
+  while (due > now + PCAPUDPSOURCE_SPIN_NS && !stopThread) {
+    uint64_t wake = std::min(due - PCAPUDPSOURCE_SPIN_NS,
+                             now + (uint64_t)100000000); // 100 ms
+    struct timespec ts;
+    ts.tv_sec = wake / 1000000000ULL;
+    ts.tv_nsec = wake % 1000000000ULL;
+
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL);
+    now = monotonic_ns();
+  }
 
-      // IP Header length is defined in a packet field (IHL).  IHL represents
-      // the # of 32-bit words So header size is ihl * 4 [bytes]
-      int etherIPHeaderSize = sizeof(ether_header) + ip->ip_hl * 4;
+  while ((now = monotonic_ns()) < due && !stopThread)
+    ;
 
-      auto udp = reinterpret_cast<const udphdr *>(p + etherIPHeaderSize);
-      if (tv.tv_sec == 0) {
-        tv = header.ts;
-      }
-      timeval diff;
-      timersub(&header.ts, &tv, &diff);
-      tv = header.ts;
+  if (now < due)
+    return; // Stopping
 
-      unsigned int delay_as_micro = (unsigned int)(0.8*(diff.tv_sec*1000000 + diff.tv_usec)); // (diff.tv_sec + diff.tv_usec / 1e6)*1e6;
+  // Late packets (reader or downstream couldn't keep up) count as error
+  // too.
+  uint64_t error = now - due;
 
-      if (delay_as_micro > 0)
-        usleep(delay_as_micro);
+  d_pace_count.fetch_add(1, std::memory_order_relaxed);
+  d_pace_error_sum_ns.fetch_add(error, std::memory_order_relaxed);
 
-      uint16_t destPort = ntohs(udp->uh_dport);
+  if (error > d_pace_error_max_ns.load(std::memory_order_relaxed))
+    d_pace_error_max_ns.store(error, std::memory_order_relaxed);
+}
 
-      if (destPort == d_port) {
-        matchingPackets++;
-        size_t len = ntohs(udp->uh_ulen) - sizeUDPHeader;
+char *PCAPUDPSource_impl::reservePacket(flow &f, size_t len) {
+  char *slot = f.ring->reserve(len);
 
-        if (len > 0) {
-          const u_char *pData = &p[etherIPHeaderSize + sizeUDPHeader];
+  // Ring full: block until work() frees something rather than polling.
+  // With pacing off this is what sets the replay speed.
+  while (slot == NULL && !stopThread) {
+    gr::thread::scoped_lock lock(d_ringMutex);
 
-          gr::thread::scoped_lock guard(d_netQueueMutex);
+    d_readerWaiting = true;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
 
-          for (int i = 0; i < len; i++) {
-            netQueue.push(pData[i]);
-          }
-        }
-      }
+    // Re-check now that work() is guaranteed to see the flag.
+    slot = f.ring->reserve(len);
 
+    if (slot == NULL)
+      d_spaceAvailable.timed_wait(lock, boost::posix_time::milliseconds(100));
 
-      // Monitor that we don't get too backed up.
-      while (!stopThread && netDataAvailable() > maxQueueSize) {
-        // Just in case we're running fast, let the system catch up.
-        usleep(20);
-      }
+    d_readerWaiting = false;
+
+    if (slot == NULL)
+      slot = f.ring->reserve(len);
+  }
+
+  return slot;
+}
+
+void PCAPUDPSource_impl::commitPacket(flow &f, size_t len, uint64_t ts_ns) {
+  f.ring->commit(len, ts_ns);
+
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (d_workWaiting) {
+    gr::thread::scoped_lock lock(d_ringMutex);
+    d_dataAvailable.notify_one();
+  }
+}
+
+bool PCAPUDPSource_impl::ringsEmpty() const {
+  for (size_t i = 0; i < d_flows.size(); i++) {
+    if (!d_flows[i].ring->empty())
+      return false;
+  }
+
+  return true;
+}
+
+bool PCAPUDPSource_impl::waitForData() {
+  // Returns true if there's data in any of the rings.
+  if (!ringsEmpty())
+    return true;
+
+  if (d_endOfFile)
+    return false;
+
+  gr::thread::scoped_lock lock(d_ringMutex);
+
+  d_workWaiting = true;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // Short timeout so the scheduler still gets control back regularly.
+  if (ringsEmpty() && !d_endOfFile)
+    d_dataAvailable.timed_wait(lock, boost::posix_time::milliseconds(10));
+
+  d_workWaiting = false;
+
+  return !ringsEmpty();
+}
 
-      if (stopThread)
+unsigned long PCAPUDPSource_impl::streamFile() {
+  // One pass through the capture.  Returns the number of packets that
+  // matched one of our ports.
+  pcap_file_reader::packet header;
+  pcap_udp_parser::udp_info udp;
+  pcap_udp_parser::ip_fragment frag;
+  unsigned long matchingPackets = 0;
+
+  restart();
+  d_reassembler.clear();
+  d_window_end_ts = 0;
+
+  while (d_reader.next(header)) {
+    if (header.len != header.caplen) {
+      continue;
+    }
+
+    pcap_udp_parser::parse_result result =
+        d_parser.parse(header, udp, frag);
+
+    if (result == pcap_udp_parser::PARSE_FRAGMENT) {
+      // Datagrams bigger than the MTU come through as fragments, and
+      // only the first one has the UDP header.  Nothing goes out until
+      // the whole datagram is here.
+      const uint8_t *datagram;
+      size_t datagramLen;
+
+      if (!d_reassembler.add(frag, header.ts_ns, datagram, datagramLen) ||
+          !d_parser.parse_udp(datagram, datagramLen, udp))
+        continue;
+
+      udp.ipVersion = 4;
+    } else if (result != pcap_udp_parser::PARSE_UDP)
+      continue;
+
+    int flowIndex = d_port_flow[udp.destPort];
+
+    if (flowIndex < 0)
+      continue;
+
+    flow &f = d_flows[flowIndex];
+
+    // Playback window
+    if (header.ts_ns < d_window_start_ts)
+      continue;
+
+    if (d_duration > 0.0) {
+      if (d_window_end_ts == 0)
+        d_window_end_ts =
+            std::max(d_window_start_ts, header.ts_ns) +
+            (uint64_t)(d_duration * 1000000000.0 + 0.5);
+
+      if (header.ts_ns >= d_window_end_ts)
         break;
     }
 
+    matchingPackets++;
+    f.matchingPackets++;
+
+    if (udp.len > 0) {
+      // All flows share the one schedule, so they stay in step with each
+      // other the way they were captured.
+      pacePacket(header.ts_ns);
+
+      // Waits for work() to free up room if we're running ahead.
+      char *slot = reservePacket(f, udp.len);
+
+      if (slot == NULL)
+        return matchingPackets; // Stopping
+
+      memcpy(slot, udp.payload, udp.len);
+      commitPacket(f, udp.len, header.ts_ns);
+
+      if (d_preloading)
+        preloadPacket(flowIndex, udp.payload, udp.len, header.ts_ns);
+    }
+
+    if (stopThread)
+      return matchingPackets;
+  }
+
+  // Made it through with everything in memory: later passes can replay
+  // from there.
+  if (d_preloading && !d_preload_packets.empty()) {
+    d_preloading = false;
+    d_preloaded = true;
+
+    std::stringstream msg;
+    msg << "[PCAP UDP Source] Preloaded " << d_preload_packets.size()
+        << " packets (" << d_preload_blob.size() / 1048576.0
+        << " MB).  Repeating from memory.";
+    GR_LOG_INFO(d_logger, msg.str());
+  }
+
+  return matchingPackets;
+}
+
+unsigned long PCAPUDPSource_impl::replayPreloaded() {
+  // Same as a pass through the file, without touching it: the payloads are
+  // packed back to back in d_preload_blob in capture order.
+  const char *data = d_preload_blob.data();
+
+  for (size_t i = 0; i < d_preload_packets.size() && !stopThread; i++) {
+    const preloaded_packet &pkt = d_preload_packets[i];
+    flow &f = d_flows[pkt.flow];
+
+    f.matchingPackets++;
+
+    pacePacket(pkt.ts_ns);
+
+    char *slot = reservePacket(f, pkt.len);
+
+    if (slot == NULL)
+      break;
+
+    memcpy(slot, data, pkt.len);
+    commitPacket(f, pkt.len, pkt.ts_ns);
+
+    data += pkt.len;
+  }
+
+  return d_preload_packets.size();
+}
+
+void PCAPUDPSource_impl::preloadPacket(int flowIndex, const uint8_t *payload,
+                                       uint32_t len, uint64_t ts_ns) {
+  size_t needed = d_preload_blob.size() + len;
+
+  if (needed + (d_preload_packets.size() + 1) * sizeof(preloaded_packet) >
+      d_preload_budget) {
+    // Too big.  Give the memory back and keep streaming from the file.
+    std::vector<char>().swap(d_preload_blob);
+    std::vector<preloaded_packet>().swap(d_preload_packets);
+    d_preloading = false;
+
+    std::stringstream msg;
+    msg << "[PCAP UDP Source] Matching traffic is larger than the "
+        << d_preload_budget / 1048576 << " MB preload budget.  Streaming "
+        << "from the file on every pass.";
+    GR_LOG_INFO(d_logger, msg.str());
+    return;
+  }
+
+  // Grow geometrically, but never past the budget.
+  if (needed > d_preload_blob.capacity())
+    d_preload_blob.reserve(std::min(
+        std::max(needed, d_preload_blob.capacity() * 2), d_preload_budget));
+
+  d_preload_blob.insert(d_preload_blob.end(), (const char *)payload,
+                        (const char *)payload + len);
+
+  preloaded_packet pkt;
+  pkt.ts_ns = ts_ns;
+  pkt.len = len;
+  pkt.flow = flowIndex;
+  d_preload_packets.push_back(pkt);
+}
+
+void PCAPUDPSource_impl::runThread() {
+  threadRunning = true;
+
+  unsigned long matchingPackets;
+
+  // Only worth keeping a copy if we're going to come back around.
+  d_preloading = d_repeat && d_preload_budget > 0;
+
+  while (!stopThread) {
+    d_pace_start = 0;
+
+    // The reassembler's count covers the life of the block.  Report each
+    // pass's share.
+    uint64_t incompleteBefore = d_reassembler.incomplete();
+
+    for (size_t i = 0; i < d_flows.size(); i++)
+      d_flows[i].matchingPackets = 0;
+
+    if (d_preloaded)
+      matchingPackets = replayPreloaded();
+    else
+      matchingPackets = streamFile();
+
+    if (d_rate > 0.0 && d_pace_count.load() > 0) {
+      std::stringstream msg;
+      msg << "[PCAP UDP Source] Pacing error over " << d_pace_count.load()
+          << " packets: mean " << pacing_error_mean_us() << " us, max "
+          << pacing_error_max_us() << " us";
+      GR_LOG_INFO(d_logger, msg.str());
+    }
+
+    uint64_t incomplete = d_reassembler.incomplete() - incompleteBefore;
+
+    if (incomplete > 0) {
+      std::stringstream msg;
+      msg << "[PCAP UDP Source] " << incomplete
+          << " fragmented datagrams could not be reassembled.";
+      GR_LOG_WARN(d_logger, msg.str());
+    }
+
     if (matchingPackets == 0) {
       std::cerr << "[PCAP UDP Source] End of file reached and no matching "
                    "packets.  Do you have the right port number?"
                 << std::endl;
-    }
-
-    while (!stopThread && netDataAvailable() > 3*d_payloadsize) {
-      // Just in case we're running fast, let the system catch up.
-      usleep(20);
+    } else {
+      for (size_t i = 0; i < d_flows.size(); i++) {
+        if (d_flows[i].matchingPackets == 0)
+          std::cerr << "[PCAP UDP Source] No packets found for port "
+                    << d_flows[i].port << "." << std::endl;
+      }
     }
 
     // end if we're not repeating.
@@ -243,226 +556,397 @@ void PCAPUDPSource_impl::runThread() {
     }
   }
 
+  // Let work() drain what's left and then finish.
+  d_endOfFile = true;
+
+  {
+    gr::thread::scoped_lock lock(d_ringMutex);
+    d_dataAvailable.notify_one();
+  }
+
   threadRunning = false;
 }
 
 void PCAPUDPSource_impl::restart() {
-  close();
-  open();
+  // Once open, repeating is just a rewind.  For mapped files that's
+  // resetting an offset; only the libpcap fallback reopens the file.
+  if (d_reader.is_open()) {
+    gr::thread::scoped_lock lock(fp_mutex);
+    d_reader.rewind();
+  } else
+    open();
+
+  if (d_have_seek_pos) {
+    gr::thread::scoped_lock lock(fp_mutex);
+
+    // If we can't seek, runThread still skips everything before the
+    // window; it just has to read through it.
+    if (!d_reader.seek(d_seek_pos)) {
+      d_reader.rewind();
+      d_have_seek_pos = false;
+      GR_LOG_WARN(d_logger, "[PCAP UDP Source] Unable to seek in capture.  "
+                            "Reading from the start.");
+    }
+  }
 }
 
-void PCAPUDPSource_impl::open() {
-  gr::thread::scoped_lock lock(fp_mutex);
-  char errbuf[PCAP_ERRBUF_SIZE];
-  try {
-    pcapFile = pcap_open_offline(d_filename.c_str(), errbuf);
+void PCAPUDPSource_impl::setupWindow() {
+  d_have_seek_pos = false;
+  d_window_start_ts = 0;
+
+  if (d_start_time <= 0.0)
+    return;
+
+  // Starting part way in needs the index: where the port's traffic starts,
+  // and where in the file to jump to.
+  pcap_index index;
+  std::string sidecar = pcap_index::sidecar_name(d_filename);
+  std::string err;
+
+  if (!index.load(sidecar, d_filename, err)) {
+    GR_LOG_INFO(d_logger, "[PCAP UDP Source] No usable index (" + err +
+                              ").  Building " + sidecar);
 
-    if (pcapFile == NULL) {
-      std::cerr << "[PCAP UDP Source] Error occurred: " << errbuf << std::endl;
+    if (!index.build(d_filename, err)) {
+      GR_LOG_WARN(d_logger, "[PCAP UDP Source] Unable to index capture: " +
+                                err + ".  Playing from the start.");
       return;
     }
-  } catch (const std::exception &ex) {
-    std::cerr << "[PCAP UDP Source] Error occurred: " << ex.what() << std::endl;
-    pcapFile = NULL;
+
+    if (!index.save(sidecar, err))
+      GR_LOG_WARN(d_logger,
+                  "[PCAP UDP Source] Unable to save index: " + err);
+  }
+
+  // The start time counts from the first packet on any of our ports.
+  uint64_t firstTs = 0;
+  uint64_t lastTs = 0;
+  bool found = false;
+
+  for (size_t i = 0; i < d_flows.size(); i++) {
+    const pcap_index::port_info *info = index.find_port(d_flows[i].port);
+
+    if (info == NULL)
+      continue;
+
+    if (!found || info->first_ts < firstTs)
+      firstTs = info->first_ts;
+
+    if (!found || info->last_ts > lastTs)
+      lastTs = info->last_ts;
+
+    found = true;
+  }
+
+  if (!found) {
+    GR_LOG_WARN(d_logger, "[PCAP UDP Source] No packets for the selected "
+                          "ports in the capture.");
+    return;
+  }
+
+  d_window_start_ts = firstTs + (uint64_t)(d_start_time * 1000000000.0 + 0.5);
+
+  if (d_window_start_ts > lastTs) {
+    std::stringstream msg;
+    msg << "[PCAP UDP Source] Start time is past the end of the port's "
+           "traffic ("
+        << (double)(lastTs - firstTs) / 1e9 << " seconds).";
+    GR_LOG_WARN(d_logger, msg.str());
+  }
+
+  // Start reading from the earliest position any of the ports needs.
+  for (size_t i = 0; i < d_flows.size(); i++) {
+    pcap_file_reader::position pos;
+
+    if (!index.find(d_flows[i].port, d_window_start_ts, pos))
+      continue;
+
+    if (!d_have_seek_pos || pos.offset < d_seek_pos.offset)
+      d_seek_pos = pos;
+
+    d_have_seek_pos = true;
   }
 }
 
-void PCAPUDPSource_impl::close() {
+void PCAPUDPSource_impl::open() {
   gr::thread::scoped_lock lock(fp_mutex);
-  if (pcapFile != NULL) {
-    pcap_close(pcapFile);
-    pcapFile = NULL;
+  std::string err;
+
+  if (!d_reader.open(d_filename, err)) {
+    std::cerr << "[PCAP UDP Source] Error occurred: " << err << std::endl;
+    return;
+  }
+
+  if (!d_reader.is_mapped()) {
+    std::cerr << "[PCAP UDP Source] File format not handled natively.  "
+                 "Reading through libpcap."
+              << std::endl;
   }
+
+  setupWindow();
+}
+
+void PCAPUDPSource_impl::close() {
+  gr::thread::scoped_lock lock(fp_mutex);
+  d_reader.close();
 }
 
 bool PCAPUDPSource_impl::stop() {
   if (readThread) {
     stopThread = true;
 
-    while (threadRunning) {
-      usleep(10000); // sleep 10 millisec
+    {
+      gr::thread::scoped_lock lock(d_ringMutex);
+      d_spaceAvailable.notify_one();
     }
 
+    readThread->join();
+
     delete readThread;
     readThread = NULL;
   }
 
   close();
 
-  if (localBuffer) {
-    delete[] localBuffer;
-    localBuffer = NULL;
+  for (size_t i = 0; i < d_flows.size(); i++) {
+    if (d_flows[i].localBuffer) {
+      delete[] d_flows[i].localBuffer;
+      d_flows[i].localBuffer = NULL;
+    }
+
+    if (d_flows[i].ring) {
+      delete d_flows[i].ring;
+      d_flows[i].ring = NULL;
+    }
   }
 
   return true;
 }
 
 size_t PCAPUDPSource_impl::dataAvailable() {
-  return (netQueue.size() + localQueue.size());
+  size_t partial = 0;
+
+  for (size_t i = 0; i < d_flows.size(); i++)
+    partial += d_flows[i].partial_bytes;
+
+  return (netDataAvailable() + partial);
 }
 
 size_t PCAPUDPSource_impl::netDataAvailable() {
-  // Get amount of data available
-  gr::thread::scoped_lock guard(d_netQueueMutex);
-  size_t size = netQueue.size();
+  // Lock-free: safe to call from either thread
+  size_t queued = 0;
 
-  return size;
+  for (size_t i = 0; i < d_flows.size(); i++)
+    queued += d_flows[i].ring->bytes_queued();
+
+  return queued;
 }
 
-uint64_t PCAPUDPSource_impl::getHeaderSeqNum() {
+uint64_t PCAPUDPSource_impl::getHeaderSeqNum(flow &f,
+                                             const unsigned char *packet) {
   uint64_t retVal = 0;
 
   switch (d_header_type) {
   case HEADERTYPE_SEQNUM: {
-    retVal = ((HeaderSeqNum *)localBuffer)->seqnum;
+    retVal = ((HeaderSeqNum *)packet)->seqnum;
   } break;
 
   case HEADERTYPE_SEQPLUSSIZE: {
-    retVal = ((HeaderSeqPlusSize *)localBuffer)->seqnum;
+    retVal = ((HeaderSeqPlusSize *)packet)->seqnum;
   } break;
 
   case HEADERTYPE_CHDR: {
     // Rollover at 12-bits
-    if (d_seq_num > 0x0FFF)
-      d_seq_num = 1;
+    if (f.seq_num > 0x0FFF)
+      f.seq_num = 1;
 
-    retVal = ((CHDR *)localBuffer)->seqPlusFlags & 0x0FFF;
+    retVal = ((CHDR *)packet)->seqPlusFlags & 0x0FFF;
   } break;
 
   case HEADERTYPE_OLDATA: {
-    retVal = ((OldATAHeader *)localBuffer)->seq;
+    retVal = ((OldATAHeader *)packet)->seq;
   } break;
   }
 
   return retVal;
 }
 
-int PCAPUDPSource_impl::work(int noutput_items,
-                             gr_vector_const_void_star &input_items,
-                             gr_vector_void_star &output_items) {
-  gr::thread::scoped_lock guard(d_mutex);
-
-  static bool firstTime = true;
-  static int testCount = 0;
-  static int underRunCounter = 0;
-
-  int bytesAvailable = netDataAvailable();
-  unsigned char *out = (unsigned char *)output_items[0];
-  unsigned int numRequested = noutput_items * d_block_size;
-
-  // quick exit if nothing to do
-  if ((bytesAvailable == 0) && (localQueue.size() == 0)) {
-    if (underRunCounter == 0) {
-      if (!firstTime) {
-        std::cout << "nU";
-      } else
-        firstTime = false;
-    } else {
-      if (underRunCounter > 100)
-        underRunCounter = 0;
-    }
+void PCAPUDPSource_impl::tagCaptureTime(int output, uint64_t item,
+                                        uint64_t ts_ns) {
+  add_item_tag(output, item, d_capture_time_key,
+               pmt::make_tuple(pmt::from_uint64(ts_ns / 1000000000ULL),
+                               pmt::from_double((ts_ns % 1000000000ULL) * 1e-9)));
+}
 
-    underRunCounter++;
+int PCAPUDPSource_impl::checkSequence(flow &f, const unsigned char *packet) {
+  // Returns the number of packets skipped before this one
+  if (d_header_type == HEADERTYPE_NONE)
     return 0;
-  }
 
-  int bytesRead;
-  int localNumItems;
+  uint64_t pktSeqNum = getHeaderSeqNum(f, packet);
+  int skipped = 0;
 
-  // we could get here even if no data was received but there's still data in
-  // the queue. however read blocks so we want to make sure we have data before
-  // we call it.
-  if (bytesAvailable > 0) {
-    bytesRead = bytesAvailable;
-
-    if (bytesRead > 0) {
-      // Get the data and add it to our local queue.  We have to maintain a
-      // local queue in case we read more bytes than noutput_items is asking
-      // for.  In that case we'll only return noutput_items bytes
-      gr::thread::scoped_lock guard(d_netQueueMutex);
-      for (int i = 0; i < bytesRead; i++) {
-        localQueue.push(netQueue.front());
-        netQueue.pop();
-      }
+  if (f.seq_num > 0) { // seq_num will be 0 when this block starts
+    if (pktSeqNum > f.seq_num) {
+      // Ideally pktSeqNum = seq_num + 1.  Therefore this should do += 0
+      // when no packets are dropped.
+      skipped = pktSeqNum - f.seq_num - 1;
     }
   }
 
-  if (localQueue.size() < d_payloadsize) {
-    // we don't have sufficient data for a block yet.
-    return 0; // Don't memset 0x00 since we're starting to get data.  In this
-              // case we'll hold for the rest.
-  }
+  // Store as current for next pass.
+  f.seq_num = pktSeqNum;
 
-  // Now if we're here we should have at least 1 block.
+  return skipped;
+}
 
-  // let's figure out how much we have in relation to noutput_items, accounting
-  // for headers
+int PCAPUDPSource_impl::readFlow(int output, unsigned char *out,
+                                 int noutput_items, bool &popped) {
+  // Copies whole blocks for one flow to its output.  Returns items
+  // produced.
+  flow &f = d_flows[output];
 
   // Number of data-only blocks requested (set_output_multiple() should make
   // sure this is an integer multiple)
   long blocksRequested = noutput_items / d_precompDataOverItemSize;
-  // Number of blocks available accounting for the header as well.
-  long blocksAvailable = localQueue.size() / (d_payloadsize);
-  long blocksRetrieved;
-  int itemsreturned;
-
-  if (blocksRequested <= blocksAvailable)
-    blocksRetrieved = blocksRequested;
-  else
-    blocksRetrieved = blocksAvailable;
+  long blocksRetrieved = 0;
+  int outIndex = 0;
+  int skippedPackets = 0;
 
-  // items returned is going to match the payload (actual data) of the number of
-  // blocks.
-  itemsreturned = blocksRetrieved * d_precompDataOverItemSize;
+  while (blocksRetrieved < blocksRequested) {
+    const packet_ring::descriptor *pkt = f.ring->front();
 
-  // We're going to have to read the data out in blocks, account for the header,
-  // then just move the data part into the out[] array.
+    if (pkt == NULL)
+      break;
 
-  unsigned char *pData;
-  pData = &localBuffer[d_header_size];
-  int outIndex = 0;
-  int skippedPackets = 0;
+    const unsigned char *pktData = (const unsigned char *)f.ring->data(pkt);
 
-  for (int curPacket = 0; curPacket < blocksRetrieved; curPacket++) {
-    // Move a packet to our local buffer
-    for (int curByte = 0; curByte < d_payloadsize; curByte++) {
-      localBuffer[curByte] = localQueue.front();
-      localQueue.pop();
-    }
+    if (f.partial_bytes == 0 && f.packet_offset == 0 &&
+        pkt->len == d_payloadsize) {
+      // Fast path: one packet is one block.  Read the header and copy the
+      // data straight out of the ring.
+      skippedPackets += checkSequence(f, pktData);
 
-    // Interpret the header if present
-    if (d_header_type != HEADERTYPE_NONE) {
-      uint64_t pktSeqNum = getHeaderSeqNum();
+      if (d_tag_capture_time)
+        tagCaptureTime(output, nitems_written(output) + outIndex / d_itemsize,
+                       pkt->timestamp_ns);
 
-      if (d_seq_num > 0) { // d_seq_num will be 0 when this block starts
-        if (pktSeqNum > d_seq_num) {
-          // Ideally pktSeqNum = d_seq_num + 1.  Therefore this should do += 0
-          // when no packets are dropped.
-          skippedPackets += pktSeqNum - d_seq_num - 1;
+      memcpy(&out[outIndex], &pktData[d_header_size], d_precompDataSize);
+      f.ring->pop();
+      popped = true;
+    } else {
+      // Packet sizes don't line up with the payload size.  Assemble a block
+      // in localBuffer from as many packets as it takes.
+      while (f.partial_bytes < d_payloadsize &&
+             (pkt = f.ring->front()) != NULL) {
+        pktData = (const unsigned char *)f.ring->data(pkt);
+
+        // The block is stamped with the packet its first byte came from
+        if (f.partial_bytes == 0)
+          f.partial_ts = pkt->timestamp_ns;
+
+        size_t n = std::min((size_t)(d_payloadsize - f.partial_bytes),
+                            (size_t)(pkt->len - f.packet_offset));
+
+        memcpy(&f.localBuffer[f.partial_bytes], &pktData[f.packet_offset], n);
+        f.partial_bytes += n;
+        f.packet_offset += n;
+
+        if (f.packet_offset == pkt->len) {
+          f.ring->pop();
+          f.packet_offset = 0;
+          popped = true;
         }
-
-        // Store as current for next pass.
-        d_seq_num = pktSeqNum;
-      } else {
-        // just starting.  Prime it for no loss on the first packet.
-        d_seq_num = pktSeqNum;
       }
+
+      // we don't have sufficient data for a block yet.  Hold what we have
+      // for the next call.
+      if (f.partial_bytes < d_payloadsize)
+        break;
+
+      skippedPackets += checkSequence(f, f.localBuffer);
+
+      if (d_tag_capture_time)
+        tagCaptureTime(output, nitems_written(output) + outIndex / d_itemsize,
+                       f.partial_ts);
+
+      memcpy(&out[outIndex], &f.localBuffer[d_header_size], d_precompDataSize);
+      f.partial_bytes = 0;
     }
 
-    // Move the data to the output buffer and increment the out index
-    memcpy(&out[outIndex], pData, d_precompDataSize);
-    outIndex = outIndex + d_precompDataSize;
+    outIndex += d_precompDataSize;
+    blocksRetrieved++;
   }
 
   if (skippedPackets > 0 && d_notifyMissed) {
     std::stringstream msg;
-    msg << "[UDP Sink port " << d_port
+    msg << "[UDP Sink port " << f.port
         << "] missed  packets: " << skippedPackets;
     GR_LOG_WARN(d_logger, msg.str());
   }
 
-  // If we had less data than requested, it'll be reflected in the return value.
-  return itemsreturned;
+  // items returned is going to match the payload (actual data) of the number
+  // of blocks.  If we had less data than requested, it'll be reflected here.
+  return blocksRetrieved * d_precompDataOverItemSize;
+}
+
+int PCAPUDPSource_impl::general_work(int noutput_items,
+                                     gr_vector_int &ninput_items,
+                                     gr_vector_const_void_star &input_items,
+                                     gr_vector_void_star &output_items) {
+  gr::thread::scoped_lock guard(d_mutex);
+
+  static bool firstTime = true;
+  static int underRunCounter = 0;
+
+  // Nothing queued: wait briefly for the reader rather than spinning
+  // through the scheduler.
+  if (!waitForData()) {
+    // Reader's finished (end of file, not repeating).  Whatever partial
+    // block is left can't be completed.
+    if (d_endOfFile && ringsEmpty())
+      return WORK_DONE;
+
+    // Unpaced playback is only waiting on the file reader; that's not an
+    // underrun worth reporting.
+    if (d_rate == 0.0)
+      return 0;
+
+    if (underRunCounter == 0) {
+      if (!firstTime) {
+        std::cout << "nU";
+      } else
+        firstTime = false;
+    } else {
+      if (underRunCounter > 100)
+        underRunCounter = 0;
+    }
+
+    underRunCounter++;
+    return 0;
+  }
+
+  // Each output gets whatever its own flow has ready.
+  bool popped = false;
+
+  for (size_t i = 0; i < d_flows.size(); i++) {
+    int produced = readFlow(i, (unsigned char *)output_items[i],
+                            noutput_items, popped);
+
+    if (produced > 0)
+      produce(i, produced);
+  }
+
+  if (popped) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (d_readerWaiting) {
+      gr::thread::scoped_lock lock(d_ringMutex);
+      d_spaceAvailable.notify_one();
+    }
+  }
+
+  return WORK_CALLED_PRODUCE;
 }
 
 } /* namespace grnet */
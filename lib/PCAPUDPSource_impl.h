@@ -22,11 +22,24 @@
 #define INCLUDED_GRNET_PCAPUDPSOURCE_IMPL_H
 
 #include <grnet/PCAPUDPSource.h>
-#include <queue>
 
 #include "packet_headers.h"
+#include "packet_ring.h"
+#include "pcap_file_reader.h"
+#include "ip_reassembler.h"
+#include "pcap_index.h"
+#include "pcap_udp_parser.h"
+#include <atomic>
+#include <vector>
 #include <boost/thread/thread.hpp>
-#include <pcap/pcap.h>
+
+// Packet staging between the file reader thread and work()
+#define PCAPUDPSOURCE_RING_BYTES (4 * 1024 * 1024)
+#define PCAPUDPSOURCE_RING_PACKETS 16384
+
+// Gaps shorter than this are spun out rather than slept, since a timer
+// wakeup can't be trusted to be any more precise than this.
+#define PCAPUDPSOURCE_SPIN_NS 50000
 
 namespace gr {
 namespace grnet {
@@ -46,46 +59,143 @@ private:
   int d_precompDataSize;
   int d_precompDataOverItemSize;
 
-  uint64_t d_seq_num;
-  unsigned char *localBuffer;
-
-  std::queue<unsigned char> localQueue;
-  std::queue<unsigned char> netQueue;
+  // One flow per output: the UDP payloads for one port, queued by the
+  // reader thread.  A packet that doesn't line up with d_payloadsize is
+  // assembled in localBuffer, with partial_bytes filled so far and
+  // packet_offset consumed from the packet at the front of the ring.
+  struct flow {
+    int port;
+    packet_ring *ring;
+    unsigned char *localBuffer;
+    size_t partial_bytes;
+    size_t packet_offset;
+    uint64_t partial_ts;
+    uint64_t seq_num;
+    unsigned long matchingPackets; // This pass through the file
+  };
+
+  std::vector<flow> d_flows;
+  std::vector<int> d_port_flow; // UDP port -> index in d_flows, or -1
+
+  bool d_tag_capture_time;
+  pmt::pmt_t d_capture_time_key;
 
   std::string d_filename;
   bool d_repeat;
 
+  // Playback window.  d_window_start_ts is the capture time to start from
+  // (0: the beginning) and d_seek_pos where the index says to read from to
+  // get there.  d_window_end_ts is set from the first packet played in each
+  // pass when a duration is given.
+  double d_start_time;
+  double d_duration;
+  uint64_t d_window_start_ts;
+  uint64_t d_window_end_ts;
+  bool d_have_seek_pos;
+  pcap_file_reader::position d_seek_pos;
+
+  // Preload for repeated playback.  The first pass through the file also
+  // packs the matching payloads back to back into d_preload_blob, with one
+  // d_preload_packets entry per payload.  If that stays inside the budget,
+  // every later pass replays from memory without reading or parsing the
+  // file.
+  struct preloaded_packet {
+    uint64_t ts_ns;
+    uint32_t len;
+    uint16_t flow;
+  };
+
+  size_t d_preload_budget; // bytes, 0 to disable
+  bool d_preloading;       // Recording during this pass
+  bool d_preloaded;        // Recording is complete; replay from it
+  std::vector<char> d_preload_blob;
+  std::vector<preloaded_packet> d_preload_packets;
+
+  // Pacing.  Each pass through the file is anchored at the first matching
+  // packet: packet i is due at d_pace_start + (ts_i - d_pace_first_ts) /
+  // d_rate on CLOCK_MONOTONIC.
+  double d_rate;
+  uint64_t d_pace_start;
+  uint64_t d_pace_first_ts;
+  std::atomic<uint64_t> d_pace_count;
+  std::atomic<uint64_t> d_pace_error_sum_ns;
+  std::atomic<uint64_t> d_pace_error_max_ns;
+
   boost::mutex d_mutex;
   boost::mutex fp_mutex;
-  boost::mutex d_netQueueMutex;
 
-  pcap_t *pcapFile;
+  pcap_file_reader d_reader;
+  pcap_udp_parser d_parser;
+  ip_reassembler d_reassembler;
 
   boost::thread *readThread = NULL;
-  bool threadRunning;
-  bool stopThread;
+  std::atomic<bool> threadRunning;
+  std::atomic<bool> stopThread;
+
+  // Backpressure between the reader thread and work().  The rings are
+  // lock-free; the mutex/conditions are only touched by a side that has to
+  // wait, and the other side only notifies when the flag says someone is
+  // waiting.
+  boost::mutex d_ringMutex;
+  boost::condition_variable d_spaceAvailable;
+  boost::condition_variable d_dataAvailable;
+  std::atomic<bool> d_readerWaiting;
+  std::atomic<bool> d_workWaiting;
+  std::atomic<bool> d_endOfFile; // Reader is done and won't add more
 
   void runThread();
+  unsigned long streamFile();
+  unsigned long replayPreloaded();
+  void preloadPacket(int flowIndex, const uint8_t *payload, uint32_t len,
+                     uint64_t ts_ns);
 
   void open();
   void close();
   void restart();
+  void setupWindow();
 
-  uint64_t getHeaderSeqNum();
+  void pacePacket(uint64_t ts_ns);
+  char *reservePacket(flow &f, size_t len);
+  void commitPacket(flow &f, size_t len, uint64_t ts_ns);
+  bool waitForData();
+  bool ringsEmpty() const;
+
+  int readFlow(int output, unsigned char *out, int noutput_items,
+               bool &popped);
+  void tagCaptureTime(int output, uint64_t item, uint64_t ts_ns);
+
+  uint64_t getHeaderSeqNum(flow &f, const unsigned char *packet);
+  int checkSequence(flow &f, const unsigned char *packet);
 
 public:
   PCAPUDPSource_impl(size_t itemsize, int port, int headerType, int payloadsize,
-                     bool notifyMissed, const char *filename, bool repeat);
+                     bool notifyMissed, const char *filename, bool repeat,
+                     double rate, bool tagCaptureTime, double startTime,
+                     double duration, const std::vector<int> &additionalPorts,
+                     int preloadMB);
   ~PCAPUDPSource_impl();
 
   bool stop();
 
+  double pacing_error_mean_us() const {
+    uint64_t count = d_pace_count.load();
+    return count ? (double)d_pace_error_sum_ns.load() / count / 1000.0 : 0.0;
+  }
+  double pacing_error_max_us() const {
+    return (double)d_pace_error_max_ns.load() / 1000.0;
+  }
+  uint64_t packets_paced() const { return d_pace_count.load(); }
+
+  uint64_t datagrams_reassembled() const { return d_reassembler.completed(); }
+  uint64_t datagrams_incomplete() const { return d_reassembler.incomplete(); }
+
   size_t dataAvailable();
   inline size_t netDataAvailable();
 
   // Where all the action really happens
-  int work(int noutput_items, gr_vector_const_void_star &input_items,
-           gr_vector_void_star &output_items);
+  int general_work(int noutput_items, gr_vector_int &ninput_items,
+                   gr_vector_const_void_star &input_items,
+                   gr_vector_void_star &output_items);
 };
 
 } // namespace grnet
@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "SC12ToComplex_impl.h"
+#include "convert_kernels.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+SC12ToComplex::sptr SC12ToComplex::make(float scale,
+                                        size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new SC12ToComplex_impl(scale, nontemporalThreshold));
+}
+
+/*
+ * The private constructor
+ */
+SC12ToComplex_impl::SC12ToComplex_impl(float scale, size_t nontemporalThreshold)
+    : gr::sync_decimator("SC12ToComplex",
+                         gr::io_signature::make(1, 1, sizeof(char)),
+                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 3),
+      d_scale(scale), d_nontemporalThreshold(nontemporalThreshold) {
+  const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+  set_alignment(std::max(1, alignment_multiple));
+}
+
+/*
+ * Our virtual destructor.
+ */
+SC12ToComplex_impl::~SC12ToComplex_impl() {}
+
+int SC12ToComplex_impl::work(int noutput_items,
+                             gr_vector_const_void_star &input_items,
+                             gr_vector_void_star &output_items) {
+  const uint8_t *in = (const uint8_t *)input_items[0];
+  float *out = (float *)output_items[0];
+
+  bool nontemporal =
+      d_nontemporalThreshold &&
+      noutput_items * sizeof(gr_complex) >= d_nontemporalThreshold;
+
+  // 3 bytes in for every 2 floats out
+  auto convert = [&](float *dst, size_t begin, size_t n) {
+    convert_sc12_to_32f(dst, in + begin / 2 * 3, d_scale, n);
+  };
+  convert_32f_output(out, 0, 2 * noutput_items, nontemporal, convert);
+
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
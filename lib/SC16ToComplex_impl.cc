@@ -680,31 +680,48 @@
 #endif
 
 #include "SC16ToComplex_impl.h"
+#include "convert_kernels.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 
 namespace gr {
 namespace grnet {
 
-SC16ToComplex::sptr SC16ToComplex::make() {
-  return gnuradio::get_initial_sptr(new SC16ToComplex_impl());
+SC16ToComplex::sptr SC16ToComplex::make(bool bigEndian, int nthreads,
+                                         size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new SC16ToComplex_impl(bigEndian, nthreads, nontemporalThreshold));
 }
 
 /*
  * The private constructor
  */
-SC16ToComplex_impl::SC16ToComplex_impl()
+SC16ToComplex_impl::SC16ToComplex_impl(bool bigEndian, int nthreads,
+                                       size_t nontemporalThreshold)
     : gr::sync_decimator("SC16ToComplex",
                          gr::io_signature::make(1, 1, sizeof(short)),
-                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 2) {
+                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 2),
+      d_bigEndian(bigEndian), d_pool(NULL),
+      d_nontemporalThreshold(nontemporalThreshold) {
   const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
   set_alignment(std::max(1, alignment_multiple));
+
+  if (nthreads > 1) {
+    d_pool = new convert_thread_pool(nthreads);
+
+    // The default buffers never hand over a call big enough for two
+    // pieces, so ask for whole pieces and room for every thread to have
+    // one, twice over.
+    int piece = CONVERT_POOL_MIN_PIECE_BYTES / sizeof(gr_complex);
+    set_output_multiple(piece);
+    set_min_output_buffer(2 * nthreads * piece);
+  }
 }
 
 /*
  * Our virtual destructor.
  */
-SC16ToComplex_impl::~SC16ToComplex_impl() {}
+SC16ToComplex_impl::~SC16ToComplex_impl() { delete d_pool; }
 
 int SC16ToComplex_impl::work(int noutput_items,
                              gr_vector_const_void_star &input_items,
@@ -712,7 +729,30 @@ int SC16ToComplex_impl::work(int noutput_items,
   const short *in = (const short *)input_items[0];
   float *out = (float *)output_items[0];
 
-  volk_16i_s32f_convert_32f(out, in, (float)SHRT_MAX, 2 * noutput_items);
+  bool nontemporal =
+      d_nontemporalThreshold &&
+      noutput_items * sizeof(gr_complex) >= d_nontemporalThreshold;
+
+  // begin and n are in floats
+  auto convert = [&](float *dst, size_t begin, size_t n) {
+    if (d_bigEndian)
+      convert_16i_be_to_32f(dst, in + begin, (float)SHRT_MAX, n);
+    else
+      volk_16i_s32f_convert_32f(dst, in + begin, (float)SHRT_MAX, n);
+  };
+
+  // begin and end are in complex samples
+  auto piece = [&](size_t begin, size_t end) -> uint64_t {
+    convert_32f_output(out, 2 * begin, 2 * end, nontemporal, convert);
+    return 0;
+  };
+
+  // Pieces start on a cache line in the output
+  if (d_pool)
+    d_pool->run(noutput_items, 64 / sizeof(float),
+                CONVERT_POOL_MIN_PIECE_BYTES / sizeof(gr_complex), piece);
+  else
+    piece(0, noutput_items);
 
   return noutput_items;
 }
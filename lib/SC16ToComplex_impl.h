@@ -680,15 +680,20 @@
 
 #include <grnet/SC16ToComplex.h>
 
+#include "convert_thread_pool.h"
+
 namespace gr {
 namespace grnet {
 
 class SC16ToComplex_impl : public SC16ToComplex {
 private:
-  // Nothing to declare in this block.
+  bool d_bigEndian;
+  convert_thread_pool *d_pool; // NULL when single threaded
+  size_t d_nontemporalThreshold;
 
 public:
-  SC16ToComplex_impl();
+  SC16ToComplex_impl(bool bigEndian, int nthreads,
+                     size_t nontemporalThreshold);
   ~SC16ToComplex_impl();
 
   // Where all the action really happens
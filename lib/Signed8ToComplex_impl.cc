@@ -680,23 +680,26 @@
 #endif
 
 #include "Signed8ToComplex_impl.h"
+#include "convert_kernels.h"
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
 
 namespace gr {
 namespace grnet {
 
-Signed8ToComplex::sptr Signed8ToComplex::make() {
-  return gnuradio::get_initial_sptr(new Signed8ToComplex_impl());
+Signed8ToComplex::sptr Signed8ToComplex::make(size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new Signed8ToComplex_impl(nontemporalThreshold));
 }
 
 /*
  * The private constructor
  */
-Signed8ToComplex_impl::Signed8ToComplex_impl()
+Signed8ToComplex_impl::Signed8ToComplex_impl(size_t nontemporalThreshold)
     : gr::sync_decimator("Signed8ToComplex",
                          gr::io_signature::make(1, 1, sizeof(char)),
-                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 2) {
+                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 2),
+      d_nontemporalThreshold(nontemporalThreshold) {
   const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
   set_alignment(std::max(1, alignment_multiple));
 }
@@ -712,8 +715,15 @@ int Signed8ToComplex_impl::work(int noutput_items,
   float *out = (float *)output_items[0];
   const int8_t *in = (const int8_t *)input_items[0];
 
+  bool nontemporal =
+      d_nontemporalThreshold &&
+      noutput_items * sizeof(gr_complex) >= d_nontemporalThreshold;
+
   // This calculates in[] * 1.0 / d_scalar
-  volk_8i_s32f_convert_32f(out, in, (float)SCHAR_MAX, 2 * noutput_items);
+  auto convert = [&](float *dst, size_t begin, size_t n) {
+    volk_8i_s32f_convert_32f(dst, in + begin, (float)SCHAR_MAX, n);
+  };
+  convert_32f_output(out, 0, 2 * noutput_items, nontemporal, convert);
 
   // Tell runtime system how many output items we produced.
   return noutput_items;
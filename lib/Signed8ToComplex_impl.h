@@ -685,10 +685,10 @@ namespace grnet {
 
 class Signed8ToComplex_impl : public Signed8ToComplex {
 private:
-  // Nothing to declare in this block.
+  size_t d_nontemporalThreshold;
 
 public:
-  Signed8ToComplex_impl();
+  Signed8ToComplex_impl(size_t nontemporalThreshold);
   ~Signed8ToComplex_impl();
 
   // Where all the action really happens
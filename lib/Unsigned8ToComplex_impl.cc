@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "Unsigned8ToComplex_impl.h"
+#include "convert_kernels.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+Unsigned8ToComplex::sptr Unsigned8ToComplex::make(size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new Unsigned8ToComplex_impl(nontemporalThreshold));
+}
+
+/*
+ * The private constructor
+ */
+Unsigned8ToComplex_impl::Unsigned8ToComplex_impl(size_t nontemporalThreshold)
+    : gr::sync_decimator("Unsigned8ToComplex",
+                         gr::io_signature::make(1, 1, sizeof(char)),
+                         gr::io_signature::make(1, 1, sizeof(gr_complex)), 2),
+      d_nontemporalThreshold(nontemporalThreshold) {
+  const int alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
+  set_alignment(std::max(1, alignment_multiple));
+}
+
+/*
+ * Our virtual destructor.
+ */
+Unsigned8ToComplex_impl::~Unsigned8ToComplex_impl() {}
+
+int Unsigned8ToComplex_impl::work(int noutput_items,
+                                  gr_vector_const_void_star &input_items,
+                                  gr_vector_void_star &output_items) {
+  float *out = (float *)output_items[0];
+  const uint8_t *in = (const uint8_t *)input_items[0];
+
+  bool nontemporal =
+      d_nontemporalThreshold &&
+      noutput_items * sizeof(gr_complex) >= d_nontemporalThreshold;
+
+  // Zero is halfway between 127 and 128
+  auto convert = [&](float *dst, size_t begin, size_t n) {
+    convert_8u_to_32f(dst, in + begin, 127.5f, 127.5f, n);
+  };
+  convert_32f_output(out, 0, 2 * noutput_items, nontemporal, convert);
+
+  // Tell runtime system how many output items we produced.
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
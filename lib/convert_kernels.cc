@@ -0,0 +1,879 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "convert_kernels.h"
+
+#include <arpa/inet.h>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRNET_X86_KERNELS
+#include <cpuid.h>
+#include <immintrin.h>
+// AVX-512 BF16 intrinsics need gcc 10 / clang 9
+#if defined(__clang__) ? (__clang_major__ >= 9) : (__GNUC__ >= 10)
+#define GRNET_X86_BF16_KERNELS
+#endif
+#endif
+
+namespace gr {
+namespace grnet {
+
+bool cpu_has_avx2() {
+#ifdef GRNET_X86_KERNELS
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#else
+  return false;
+#endif
+}
+
+/*
+ * Portable versions.  These also finish off whatever is left over after
+ * the last full SIMD vector.  The float to integer ones take the offset
+ * already scaled, as {I, Q}, and always start on an I value.
+ */
+static void convert_16i_be_to_32f_generic(float *out, const int16_t *in,
+                                          float scalar, size_t num_points) {
+  const float inv = 1.0f / scalar;
+
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = (float)(int16_t)ntohs((uint16_t)in[i]) * inv;
+}
+
+static inline float saturate(float r, float lo, float hi, uint64_t &clipped) {
+  if (r > hi) {
+    clipped++;
+    return hi;
+  }
+  if (r < lo) {
+    clipped++;
+    return lo;
+  }
+  return r;
+}
+
+static uint64_t convert_32f_to_16i_generic(int16_t *out, const float *in,
+                                           float scalar, const float *offset,
+                                           bool bigEndian, size_t num_points) {
+  uint64_t clipped = 0;
+
+  for (size_t i = 0; i < num_points; i++) {
+    float r = saturate(in[i] * scalar + offset[i & 1], (float)SHRT_MIN,
+                       (float)SHRT_MAX, clipped);
+    int16_t v = (int16_t)rintf(r);
+
+    out[i] = bigEndian ? (int16_t)htons((uint16_t)v) : v;
+  }
+
+  return clipped;
+}
+
+static uint64_t convert_32f_to_8i_generic(int8_t *out, const float *in,
+                                          float scalar, const float *offset,
+                                          size_t num_points) {
+  uint64_t clipped = 0;
+
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = (int8_t)rintf(saturate(in[i] * scalar + offset[i & 1],
+                                    (float)SCHAR_MIN, (float)SCHAR_MAX,
+                                    clipped));
+
+  return clipped;
+}
+
+static void convert_8u_to_32f_generic(float *out, const uint8_t *in,
+                                      float scalar, float bias,
+                                      size_t num_points) {
+  const float inv = 1.0f / scalar;
+
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = ((float)in[i] - bias) * inv;
+}
+
+static uint64_t convert_32f_to_8u_generic(uint8_t *out, const float *in,
+                                          float scalar, float bias,
+                                          size_t num_points) {
+  uint64_t clipped = 0;
+
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = (uint8_t)rintf(
+        saturate(in[i] * scalar + bias, 0.0f, 255.0f, clipped));
+
+  return clipped;
+}
+
+static uint64_t convert_32f_to_sc12_generic(uint8_t *out, const float *in,
+                                            float scalar, size_t num_points) {
+  uint64_t clipped = 0;
+
+  for (size_t i = 0; i < num_points; i += 2, out += 3) {
+    int32_t I = (int32_t)rintf(
+        saturate(in[i] * scalar, -2048.0f, 2047.0f, clipped));
+    int32_t Q = (int32_t)rintf(
+        saturate(in[i + 1] * scalar, -2048.0f, 2047.0f, clipped));
+    uint32_t w = ((uint32_t)I & 0xfff) | (((uint32_t)Q & 0xfff) << 12);
+
+    out[0] = w;
+    out[1] = w >> 8;
+    out[2] = w >> 16;
+  }
+
+  return clipped;
+}
+
+static void convert_sc12_to_32f_generic(float *out, const uint8_t *in,
+                                        float scalar, size_t num_points) {
+  const float inv = 1.0f / scalar;
+
+  for (size_t i = 0; i < num_points; i += 2, in += 3) {
+    uint32_t w = in[0] | (in[1] << 8) | (in[2] << 16);
+
+    // Shift each 12-bit field to the top and back to sign extend it
+    out[i] = (float)((int32_t)(w << 20) >> 20) * inv;
+    out[i + 1] = (float)((int32_t)(w << 8) >> 20) * inv;
+  }
+}
+
+static uint64_t convert_32f_to_sc4_generic(uint8_t *out, const float *in,
+                                           float scalar, size_t num_points) {
+  uint64_t clipped = 0;
+
+  for (size_t i = 0; i < num_points; i += 2) {
+    int32_t I =
+        (int32_t)rintf(saturate(in[i] * scalar, -8.0f, 7.0f, clipped));
+    int32_t Q =
+        (int32_t)rintf(saturate(in[i + 1] * scalar, -8.0f, 7.0f, clipped));
+
+    *out++ = (I & 0x0f) | ((Q & 0x0f) << 4);
+  }
+
+  return clipped;
+}
+
+static void convert_sc4_to_32f_generic(float *out, const uint8_t *in,
+                                       float scalar, size_t num_points) {
+  const float inv = 1.0f / scalar;
+
+  for (size_t i = 0; i < num_points; i += 2, in++) {
+    out[i] = (float)((int8_t)(*in << 4) >> 4) * inv;
+    out[i + 1] = (float)((int8_t)*in >> 4) * inv;
+  }
+}
+
+static inline uint16_t float_to_half(float f) {
+  uint32_t x;
+  memcpy(&x, &f, sizeof(x));
+
+  uint32_t sign = (x >> 16) & 0x8000;
+  uint32_t abs = x & 0x7fffffff;
+
+  if (abs >= 0x7f800000) {
+    // Inf, or NaN kept quiet with the top of its payload
+    return sign | 0x7c00 |
+           (abs > 0x7f800000 ? 0x200 | ((abs >> 13) & 0x3ff) : 0);
+  }
+  if (abs >= 0x477ff000) // Rounds to 65520 or more
+    return sign | 0x7c00;
+
+  uint32_t h, rem, half;
+
+  if (abs >= 0x38800000) {
+    // Normal: rebias the exponent (127 -> 15) and drop 13 mantissa bits
+    h = (abs - 0x38000000) >> 13;
+    rem = abs & 0x1fff;
+    half = 0x1000;
+  } else if (abs >= 0x33000000) {
+    // Subnormal half: shift the mantissa, with its implicit 1, into place
+    uint32_t shift = 126 - (abs >> 23);
+    uint32_t m = (abs & 0x7fffff) | 0x800000;
+
+    h = m >> shift;
+    rem = m & ((1u << shift) - 1);
+    half = 1u << (shift - 1);
+  } else {
+    return sign;
+  }
+
+  if (rem > half || (rem == half && (h & 1)))
+    h++;
+
+  return sign | h;
+}
+
+static inline float half_to_float(uint16_t h) {
+  uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+  uint32_t exp = (h >> 10) & 0x1f;
+  uint32_t man = h & 0x3ff;
+  uint32_t x;
+
+  if (exp == 0x1f) {
+    x = sign | 0x7f800000 | (man << 13);
+    if (man)
+      x |= 0x400000; // Quiet signalling NaNs, as vcvtph2ps does
+  } else if (exp) {
+    x = sign | ((exp + 112) << 23) | (man << 13);
+  } else if (man) {
+    // Subnormal half, normal as a float
+    exp = 113;
+    while (!(man & 0x400)) {
+      man <<= 1;
+      exp--;
+    }
+    x = sign | (exp << 23) | ((man & 0x3ff) << 13);
+  } else {
+    x = sign;
+  }
+
+  float f;
+  memcpy(&f, &x, sizeof(f));
+  return f;
+}
+
+static inline uint16_t float_to_bf16(float f) {
+  uint32_t x;
+  memcpy(&x, &f, sizeof(x));
+
+  if ((x & 0x7fffffff) > 0x7f800000)
+    return (x >> 16) | 0x40; // Keep NaNs quiet
+
+  return (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+}
+
+static void convert_32f_to_16f_generic(uint16_t *out, const float *in,
+                                       size_t num_points) {
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = float_to_half(in[i]);
+}
+
+static void convert_16f_to_32f_generic(float *out, const uint16_t *in,
+                                       size_t num_points) {
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = half_to_float(in[i]);
+}
+
+static void convert_32f_to_bf16_generic(uint16_t *out, const float *in,
+                                        size_t num_points) {
+  for (size_t i = 0; i < num_points; i++)
+    out[i] = float_to_bf16(in[i]);
+}
+
+static void convert_bf16_to_32f_generic(float *out, const uint16_t *in,
+                                        size_t num_points) {
+  for (size_t i = 0; i < num_points; i++) {
+    uint32_t x = (uint32_t)in[i] << 16;
+    memcpy(out + i, &x, sizeof(x));
+  }
+}
+
+static void stream_32f_generic(float *out, const float *in,
+                               size_t num_points) {
+  memcpy(out, in, num_points * sizeof(float));
+}
+
+#ifdef GRNET_X86_KERNELS
+// pshufb mask exchanging the two bytes of every 16-bit lane
+#define GRNET_SWAP16_MASK                                                      \
+  _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1,    \
+                   0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+
+__attribute__((target("avx2"))) static void
+convert_16i_be_to_32f_avx2(float *out, const int16_t *in, float scalar,
+                           size_t num_points) {
+  const __m256i swap = GRNET_SWAP16_MASK;
+  const __m256 inv = _mm256_set1_ps(1.0f / scalar);
+  size_t i = 0;
+
+  // 16 shorts per pass: swap in register, widen each half to int32, then
+  // cvtdq2ps and scale.
+  for (; i + 16 <= num_points; i += 16) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(in + i));
+    v = _mm256_shuffle_epi8(v, swap);
+
+    __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(v));
+    __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(v, 1));
+
+    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), inv));
+    _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), inv));
+  }
+
+  convert_16i_be_to_32f_generic(out + i, in + i, scalar, num_points - i);
+}
+
+/*
+ * Scale, offset and clamp 8 floats, counting the lanes that clipped in
+ * count (each clipped lane subtracts -1).  Clamping has to happen before
+ * cvtps2dq anyway: out of range values would come back as INT_MIN rather
+ * than saturating.
+ */
+__attribute__((target("avx2"))) static inline __m256i
+scale_and_clamp(const float *in, __m256 scalar, __m256 offset, __m256 lo,
+                __m256 hi, __m256i &count) {
+  __m256 v = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(in), scalar), offset);
+  __m256 over = _mm256_or_ps(_mm256_cmp_ps(v, hi, _CMP_GT_OQ),
+                             _mm256_cmp_ps(v, lo, _CMP_LT_OQ));
+
+  count = _mm256_sub_epi32(count, _mm256_castps_si256(over));
+
+  return _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(v, lo), hi));
+}
+
+__attribute__((target("avx2"))) static uint64_t
+horizontal_sum(__m256i count) {
+  int32_t lanes[8];
+  uint64_t sum = 0;
+
+  _mm256_storeu_si256((__m256i *)lanes, count);
+  for (int i = 0; i < 8; i++)
+    sum += (uint32_t)lanes[i];
+
+  return sum;
+}
+
+__attribute__((target("avx2"))) static uint64_t
+convert_32f_to_16i_avx2(int16_t *out, const float *in, float scalar,
+                        const float *offset, bool bigEndian,
+                        size_t num_points) {
+  const __m256i swap = GRNET_SWAP16_MASK;
+  const __m256 vscalar = _mm256_set1_ps(scalar);
+  const __m256 voffset = _mm256_setr_ps(offset[0], offset[1], offset[0],
+                                        offset[1], offset[0], offset[1],
+                                        offset[0], offset[1]);
+  const __m256 lo = _mm256_set1_ps((float)SHRT_MIN);
+  const __m256 hi = _mm256_set1_ps((float)SHRT_MAX);
+  __m256i count = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16) {
+    __m256i a = scale_and_clamp(in + i, vscalar, voffset, lo, hi, count);
+    __m256i b = scale_and_clamp(in + i + 8, vscalar, voffset, lo, hi, count);
+
+    // packssdw works within 128-bit lanes, so put the quadwords back in
+    // order before storing.
+    __m256i v = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+    if (bigEndian)
+      v = _mm256_shuffle_epi8(v, swap);
+
+    _mm256_storeu_si256((__m256i *)(out + i), v);
+  }
+
+  return horizontal_sum(count) +
+         convert_32f_to_16i_generic(out + i, in + i, scalar, offset,
+                                    bigEndian, num_points - i);
+}
+
+__attribute__((target("avx2"))) static uint64_t
+convert_32f_to_8i_avx2(int8_t *out, const float *in, float scalar,
+                       const float *offset, size_t num_points) {
+  const __m256 vscalar = _mm256_set1_ps(scalar);
+  const __m256 voffset = _mm256_setr_ps(offset[0], offset[1], offset[0],
+                                        offset[1], offset[0], offset[1],
+                                        offset[0], offset[1]);
+  const __m256 lo = _mm256_set1_ps((float)SCHAR_MIN);
+  const __m256 hi = _mm256_set1_ps((float)SCHAR_MAX);
+  // Two rounds of in-lane packing leave the dwords as a0 b0 c0 d0 a1 b1
+  // c1 d1; this puts them back in a0 a1 b0 b1 ... order.
+  const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  __m256i count = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 32 <= num_points; i += 32) {
+    __m256i a = scale_and_clamp(in + i, vscalar, voffset, lo, hi, count);
+    __m256i b = scale_and_clamp(in + i + 8, vscalar, voffset, lo, hi, count);
+    __m256i c = scale_and_clamp(in + i + 16, vscalar, voffset, lo, hi, count);
+    __m256i d = scale_and_clamp(in + i + 24, vscalar, voffset, lo, hi, count);
+
+    __m256i v = _mm256_packs_epi16(_mm256_packs_epi32(a, b),
+                                   _mm256_packs_epi32(c, d));
+    v = _mm256_permutevar8x32_epi32(v, order);
+
+    _mm256_storeu_si256((__m256i *)(out + i), v);
+  }
+
+  return horizontal_sum(count) +
+         convert_32f_to_8i_generic(out + i, in + i, scalar, offset,
+                                   num_points - i);
+}
+
+__attribute__((target("avx2"))) static void
+convert_8u_to_32f_avx2(float *out, const uint8_t *in, float scalar, float bias,
+                       size_t num_points) {
+  const __m256 vbias = _mm256_set1_ps(bias);
+  const __m256 inv = _mm256_set1_ps(1.0f / scalar);
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(in + i));
+    __m256 a = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v));
+    __m256 b = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+
+    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_sub_ps(a, vbias), inv));
+    _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_sub_ps(b, vbias), inv));
+  }
+
+  convert_8u_to_32f_generic(out + i, in + i, scalar, bias, num_points - i);
+}
+
+__attribute__((target("avx2"))) static uint64_t
+convert_32f_to_8u_avx2(uint8_t *out, const float *in, float scalar, float bias,
+                       size_t num_points) {
+  const __m256 vscalar = _mm256_set1_ps(scalar);
+  const __m256 vbias = _mm256_set1_ps(bias);
+  const __m256 lo = _mm256_setzero_ps();
+  const __m256 hi = _mm256_set1_ps(255.0f);
+  const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  __m256i count = _mm256_setzero_si256();
+  size_t i = 0;
+
+  // As convert_32f_to_8i, with an unsigned saturating final pack
+  for (; i + 32 <= num_points; i += 32) {
+    __m256i a = scale_and_clamp(in + i, vscalar, vbias, lo, hi, count);
+    __m256i b = scale_and_clamp(in + i + 8, vscalar, vbias, lo, hi, count);
+    __m256i c = scale_and_clamp(in + i + 16, vscalar, vbias, lo, hi, count);
+    __m256i d = scale_and_clamp(in + i + 24, vscalar, vbias, lo, hi, count);
+
+    __m256i v = _mm256_packus_epi16(_mm256_packs_epi32(a, b),
+                                    _mm256_packs_epi32(c, d));
+    v = _mm256_permutevar8x32_epi32(v, order);
+
+    _mm256_storeu_si256((__m256i *)(out + i), v);
+  }
+
+  return horizontal_sum(count) +
+         convert_32f_to_8u_generic(out + i, in + i, scalar, bias,
+                                   num_points - i);
+}
+
+/*
+ * SC12: the pairs are first packed to int16 I/Q (one dword per pair),
+ * each dword squeezed to 24 bits, and pshufb drops the top byte of each.
+ * Unpacking reverses that, leaving the fields in the top of int16 I/Q
+ * pairs (so 16x the value) for the widening convert.
+ */
+__attribute__((target("avx2"))) static uint64_t
+convert_32f_to_sc12_avx2(uint8_t *out, const float *in, float scalar,
+                         size_t num_points) {
+  const __m256 vscalar = _mm256_set1_ps(scalar);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 lo = _mm256_set1_ps(-2048.0f);
+  const __m256 hi = _mm256_set1_ps(2047.0f);
+  const __m256i imask = _mm256_set1_epi32(0x00000fff);
+  const __m256i qmask = _mm256_set1_epi32(0x00fff000);
+  const __m256i compact = _mm256_setr_epi8(
+      0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5,
+      6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  const __m256i order = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+  __m256i count = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16, out += 24) {
+    __m256i a = scale_and_clamp(in + i, vscalar, zero, lo, hi, count);
+    __m256i b = scale_and_clamp(in + i + 8, vscalar, zero, lo, hi, count);
+    __m256i x = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+
+    __m256i w =
+        _mm256_or_si256(_mm256_and_si256(x, imask),
+                        _mm256_and_si256(_mm256_srli_epi32(x, 4), qmask));
+    w = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(w, compact), order);
+
+    _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(w));
+    _mm_storel_epi64((__m128i *)(out + 16), _mm256_extracti128_si256(w, 1));
+  }
+
+  return horizontal_sum(count) +
+         convert_32f_to_sc12_generic(out, in + i, scalar, num_points - i);
+}
+
+__attribute__((target("avx2"))) static void
+convert_sc12_to_32f_avx2(float *out, const uint8_t *in, float scalar,
+                         size_t num_points) {
+  // The high lane is loaded from in + 8, so its 12 bytes start at 4
+  const __m256i expand = _mm256_setr_epi8(
+      0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1, 4, 5, 6, -1, 7, 8,
+      9, -1, 10, 11, 12, -1, 13, 14, 15, -1);
+  const __m256i imask = _mm256_set1_epi32(0x0000fff0);
+  const __m256i qmask = _mm256_set1_epi32((int)0xfff00000);
+  const __m256 inv = _mm256_set1_ps(1.0f / scalar / 16.0f);
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16, in += 24) {
+    __m256i w = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)in)),
+        _mm_loadu_si128((const __m128i *)(in + 8)), 1);
+    w = _mm256_shuffle_epi8(w, expand);
+
+    __m256i x =
+        _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(w, 4), imask),
+                        _mm256_and_si256(_mm256_slli_epi32(w, 8), qmask));
+    __m256i x0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x));
+    __m256i x1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1));
+
+    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x0), inv));
+    _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(x1), inv));
+  }
+
+  convert_sc12_to_32f_generic(out + i, in, scalar, num_points - i);
+}
+
+/*
+ * SC4: pack to int8 I/Q as for convert_32f_to_8i, then fold each I/Q
+ * pair into its low byte.  Unpacking puts the nibbles at the top of int16
+ * I/Q pairs (4096x the value).
+ */
+__attribute__((target("avx2"))) static uint64_t
+convert_32f_to_sc4_avx2(uint8_t *out, const float *in, float scalar,
+                        size_t num_points) {
+  const __m256 vscalar = _mm256_set1_ps(scalar);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 lo = _mm256_set1_ps(-8.0f);
+  const __m256 hi = _mm256_set1_ps(7.0f);
+  const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  const __m256i imask = _mm256_set1_epi16(0x000f);
+  const __m256i qmask = _mm256_set1_epi16(0x00f0);
+  __m256i count = _mm256_setzero_si256();
+  size_t i = 0;
+
+  for (; i + 32 <= num_points; i += 32, out += 16) {
+    __m256i a = scale_and_clamp(in + i, vscalar, zero, lo, hi, count);
+    __m256i b = scale_and_clamp(in + i + 8, vscalar, zero, lo, hi, count);
+    __m256i c = scale_and_clamp(in + i + 16, vscalar, zero, lo, hi, count);
+    __m256i d = scale_and_clamp(in + i + 24, vscalar, zero, lo, hi, count);
+
+    __m256i v = _mm256_packs_epi16(_mm256_packs_epi32(a, b),
+                                   _mm256_packs_epi32(c, d));
+    v = _mm256_permutevar8x32_epi32(v, order);
+
+    __m256i y =
+        _mm256_or_si256(_mm256_and_si256(v, imask),
+                        _mm256_and_si256(_mm256_srli_epi16(v, 4), qmask));
+    y = _mm256_permute4x64_epi64(_mm256_packus_epi16(y, y), 0x08);
+
+    _mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(y));
+  }
+
+  return horizontal_sum(count) +
+         convert_32f_to_sc4_generic(out, in + i, scalar, num_points - i);
+}
+
+__attribute__((target("avx2"))) static void
+convert_sc4_to_32f_avx2(float *out, const uint8_t *in, float scalar,
+                        size_t num_points) {
+  const __m256i imask = _mm256_set1_epi32(0x0000f000);
+  const __m256i qmask = _mm256_set1_epi32((int)0xf0000000);
+  const __m256 inv = _mm256_set1_ps(1.0f / scalar / 4096.0f);
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16, in += 8) {
+    __m256i b = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)in));
+    __m256i x =
+        _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi32(b, 12), imask),
+                        _mm256_and_si256(_mm256_slli_epi32(b, 24), qmask));
+    __m256i x0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x));
+    __m256i x1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1));
+
+    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x0), inv));
+    _mm256_storeu_ps(out + i + 8, _mm256_mul_ps(_mm256_cvtepi32_ps(x1), inv));
+  }
+
+  convert_sc4_to_32f_generic(out + i, in, scalar, num_points - i);
+}
+
+/*
+ * FP16 with F16C (vcvtps2ph / vcvtph2ps).
+ */
+__attribute__((target("avx,f16c"))) static void
+convert_32f_to_16f_f16c(uint16_t *out, const float *in, size_t num_points) {
+  size_t i = 0;
+
+  for (; i + 8 <= num_points; i += 8)
+    _mm_storeu_si128((__m128i *)(out + i),
+                     _mm256_cvtps_ph(_mm256_loadu_ps(in + i),
+                                     _MM_FROUND_TO_NEAREST_INT));
+
+  convert_32f_to_16f_generic(out + i, in + i, num_points - i);
+}
+
+__attribute__((target("avx,f16c"))) static void
+convert_16f_to_32f_f16c(float *out, const uint16_t *in, size_t num_points) {
+  size_t i = 0;
+
+  for (; i + 8 <= num_points; i += 8)
+    _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(
+                                  (const __m128i *)(in + i))));
+
+  convert_16f_to_32f_generic(out + i, in + i, num_points - i);
+}
+
+/*
+ * bfloat16 is the top half of a float, so AVX2 does the rounding with
+ * integer adds; AVX-512 BF16 has an instruction for it.
+ */
+__attribute__((target("avx2"))) static void
+convert_32f_to_bf16_avx2(uint16_t *out, const float *in, size_t num_points) {
+  const __m256i round = _mm256_set1_epi32(0x7fff);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i absmask = _mm256_set1_epi32(0x7fffffff);
+  const __m256i inf = _mm256_set1_epi32(0x7f800000);
+  const __m256i quiet = _mm256_set1_epi32(0x40);
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16) {
+    __m256i r[2];
+
+    for (int j = 0; j < 2; j++) {
+      __m256i x = _mm256_loadu_si256((const __m256i *)(in + i + 8 * j));
+      __m256i top = _mm256_srli_epi32(x, 16);
+      __m256i rounded = _mm256_srli_epi32(
+          _mm256_add_epi32(
+              x, _mm256_add_epi32(round, _mm256_and_si256(top, one))),
+          16);
+      __m256i nan =
+          _mm256_cmpgt_epi32(_mm256_and_si256(x, absmask), inf);
+
+      r[j] = _mm256_blendv_epi8(rounded, _mm256_or_si256(top, quiet), nan);
+    }
+
+    __m256i v =
+        _mm256_permute4x64_epi64(_mm256_packus_epi32(r[0], r[1]), 0xd8);
+    _mm256_storeu_si256((__m256i *)(out + i), v);
+  }
+
+  convert_32f_to_bf16_generic(out + i, in + i, num_points - i);
+}
+
+__attribute__((target("avx2"))) static void
+convert_bf16_to_32f_avx2(float *out, const uint16_t *in, size_t num_points) {
+  size_t i = 0;
+
+  for (; i + 8 <= num_points; i += 8) {
+    __m256i x =
+        _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(in + i)));
+    _mm256_storeu_si256((__m256i *)(out + i), _mm256_slli_epi32(x, 16));
+  }
+
+  convert_bf16_to_32f_generic(out + i, in + i, num_points - i);
+}
+
+#ifdef GRNET_X86_BF16_KERNELS
+/*
+ * vcvtneps2bf16 rounds and quiets NaNs the same way float_to_bf16() does,
+ * but flushes denormal inputs to zero.  Denormals are rare in sample
+ * data, so a block of 16 holding any goes through the scalar path to keep
+ * the output identical on every CPU.
+ */
+__attribute__((target("avx512f,avx512bf16"))) static void
+convert_32f_to_bf16_avx512(uint16_t *out, const float *in, size_t num_points) {
+  const __m512i expmask = _mm512_set1_epi32(0x7f800000);
+  const __m512i manmask = _mm512_set1_epi32(0x007fffff);
+  size_t i = 0;
+
+  for (; i + 16 <= num_points; i += 16) {
+    __m512 f = _mm512_loadu_ps(in + i);
+    __m512i x = _mm512_castps_si512(f);
+    __mmask16 denormal = _mm512_testn_epi32_mask(x, expmask) &
+                         _mm512_test_epi32_mask(x, manmask);
+
+    if (denormal) {
+      convert_32f_to_bf16_generic(out + i, in + i, 16);
+      continue;
+    }
+
+    __m256bh v = _mm512_cvtneps_pbh(f);
+    _mm256_storeu_si256((__m256i *)(out + i), (__m256i)v);
+  }
+
+  convert_32f_to_bf16_generic(out + i, in + i, num_points - i);
+}
+#endif
+
+/*
+ * movntps needs a 32 byte aligned destination, so the first few floats
+ * are stored normally to get there.  The sfence orders the streaming
+ * stores before whatever the scheduler does next to publish the buffer.
+ */
+__attribute__((target("avx2"))) static void
+stream_32f_avx2(float *out, const float *in, size_t num_points) {
+  size_t i = 0;
+
+  for (; i < num_points && ((uintptr_t)(out + i) & 31); i++)
+    out[i] = in[i];
+
+  for (; i + 16 <= num_points; i += 16) {
+    _mm256_stream_ps(out + i, _mm256_loadu_ps(in + i));
+    _mm256_stream_ps(out + i + 8, _mm256_loadu_ps(in + i + 8));
+  }
+
+  for (; i < num_points; i++)
+    out[i] = in[i];
+
+  _mm_sfence();
+}
+
+static bool cpu_has_f16c() {
+  unsigned int eax, ebx, ecx, edx;
+
+  // F16C needs the OS to save ymm state, which the AVX2 check covers
+  return cpu_has_avx2() && __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+         (ecx & bit_F16C);
+}
+
+#ifdef GRNET_X86_BF16_KERNELS
+static bool cpu_has_avx512bf16() {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx512bf16");
+}
+#endif
+#endif
+
+// Each public entry point resolves its kernel once, on first use.
+#ifdef GRNET_X86_KERNELS
+#define GRNET_SELECT_KERNEL(name)                                              \
+  (cpu_has_avx2() ? name##_avx2 : name##_generic)
+#else
+#define GRNET_SELECT_KERNEL(name) (name##_generic)
+#endif
+
+void convert_16i_be_to_32f(float *out, const int16_t *in, float scalar,
+                           size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_16i_be_to_32f);
+  kernel(out, in, scalar, num_points);
+}
+
+uint64_t convert_32f_to_16i(int16_t *out, const float *in, float scalar,
+                            gr_complex offset, bool bigEndian,
+                            size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_32f_to_16i);
+  const float scaled[2] = {offset.real() * scalar, offset.imag() * scalar};
+
+  return kernel(out, in, scalar, scaled, bigEndian, num_points);
+}
+
+uint64_t convert_32f_to_8i(int8_t *out, const float *in, float scalar,
+                           gr_complex offset, size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_32f_to_8i);
+  const float scaled[2] = {offset.real() * scalar, offset.imag() * scalar};
+
+  return kernel(out, in, scalar, scaled, num_points);
+}
+
+void convert_8u_to_32f(float *out, const uint8_t *in, float scalar, float bias,
+                       size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_8u_to_32f);
+  kernel(out, in, scalar, bias, num_points);
+}
+
+uint64_t convert_32f_to_8u(uint8_t *out, const float *in, float scalar,
+                           float bias, size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_32f_to_8u);
+  return kernel(out, in, scalar, bias, num_points);
+}
+
+uint64_t convert_32f_to_sc12(uint8_t *out, const float *in, float scalar,
+                             size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_32f_to_sc12);
+  return kernel(out, in, scalar, num_points);
+}
+
+void convert_sc12_to_32f(float *out, const uint8_t *in, float scalar,
+                         size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_sc12_to_32f);
+  kernel(out, in, scalar, num_points);
+}
+
+uint64_t convert_32f_to_sc4(uint8_t *out, const float *in, float scalar,
+                            size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_32f_to_sc4);
+  return kernel(out, in, scalar, num_points);
+}
+
+void convert_sc4_to_32f(float *out, const uint8_t *in, float scalar,
+                        size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(convert_sc4_to_32f);
+  kernel(out, in, scalar, num_points);
+}
+
+typedef void (*convert_32f_to_16f_fn)(uint16_t *, const float *, size_t);
+typedef void (*convert_16f_to_32f_fn)(float *, const uint16_t *, size_t);
+
+static convert_32f_to_16f_fn select_32f_to_16f(bool bfloat16) {
+#ifdef GRNET_X86_BF16_KERNELS
+  if (bfloat16 && cpu_has_avx512bf16())
+    return convert_32f_to_bf16_avx512;
+#endif
+#ifdef GRNET_X86_KERNELS
+  if (bfloat16 && cpu_has_avx2())
+    return convert_32f_to_bf16_avx2;
+  if (!bfloat16 && cpu_has_f16c())
+    return convert_32f_to_16f_f16c;
+#endif
+  return bfloat16 ? convert_32f_to_bf16_generic : convert_32f_to_16f_generic;
+}
+
+static convert_16f_to_32f_fn select_16f_to_32f(bool bfloat16) {
+#ifdef GRNET_X86_KERNELS
+  if (bfloat16 && cpu_has_avx2())
+    return convert_bf16_to_32f_avx2;
+  if (!bfloat16 && cpu_has_f16c())
+    return convert_16f_to_32f_f16c;
+#endif
+  return bfloat16 ? convert_bf16_to_32f_generic : convert_16f_to_32f_generic;
+}
+
+void convert_32f_to_16f(uint16_t *out, const float *in, bool bfloat16,
+                        size_t num_points) {
+  static const convert_32f_to_16f_fn fp16 = select_32f_to_16f(false);
+  static const convert_32f_to_16f_fn bf16 = select_32f_to_16f(true);
+
+  (bfloat16 ? bf16 : fp16)(out, in, num_points);
+}
+
+void convert_16f_to_32f(float *out, const uint16_t *in, bool bfloat16,
+                        size_t num_points) {
+  static const convert_16f_to_32f_fn fp16 = select_16f_to_32f(false);
+  static const convert_16f_to_32f_fn bf16 = select_16f_to_32f(true);
+
+  (bfloat16 ? bf16 : fp16)(out, in, num_points);
+}
+
+void convert_32f_to_16f_reference(uint16_t *out, const float *in,
+                                  bool bfloat16, size_t num_points) {
+  if (bfloat16)
+    convert_32f_to_bf16_generic(out, in, num_points);
+  else
+    convert_32f_to_16f_generic(out, in, num_points);
+}
+
+void convert_16f_to_32f_reference(float *out, const uint16_t *in,
+                                  bool bfloat16, size_t num_points) {
+  if (bfloat16)
+    convert_bf16_to_32f_generic(out, in, num_points);
+  else
+    convert_16f_to_32f_generic(out, in, num_points);
+}
+
+void stream_32f(float *out, const float *in, size_t num_points) {
+  static const auto kernel = GRNET_SELECT_KERNEL(stream_32f);
+  kernel(out, in, num_points);
+}
+
+} // namespace grnet
+} // namespace gr
@@ -0,0 +1,143 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_CONVERT_KERNELS_H
+#define INCLUDED_GRNET_CONVERT_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <gnuradio/gr_complex.h>
+
+/*
+ * Sample conversions volk doesn't cover.  Each one is a single pass over
+ * the data with an AVX2 version picked at runtime when the CPU has it and
+ * a portable scalar version otherwise.  Arguments follow volk's
+ * (out, in, scalar, num_points) order and scaling: num_points counts
+ * scalar values (2 per complex sample), and out = in / scalar going to
+ * float.  Going from float, out = (in + offset) * scalar, where offset is
+ * a DC offset applied to I and Q, rounded to nearest and saturated at the
+ * integer limits the way volk_32f_s32f_convert_16i/8i do.  Those return
+ * how many values were beyond full scale and got clipped.
+ */
+
+namespace gr {
+namespace grnet {
+
+// True when the CPU (and OS) can run the AVX2 kernels here and elsewhere
+// in the library.
+bool cpu_has_avx2();
+
+// Big-endian (network order, e.g. VITA-49) shorts to float, byte swap
+// and conversion fused.
+void convert_16i_be_to_32f(float *out, const int16_t *in, float scalar,
+                           size_t num_points);
+
+// Interleaved I/Q floats to shorts, host or big-endian order.
+// num_points must be even.
+uint64_t convert_32f_to_16i(int16_t *out, const float *in, float scalar,
+                            gr_complex offset, bool bigEndian,
+                            size_t num_points);
+
+// Interleaved I/Q floats to signed bytes.  num_points must be even.
+uint64_t convert_32f_to_8i(int8_t *out, const float *in, float scalar,
+                           gr_complex offset, size_t num_points);
+
+/*
+ * Offset binary bytes (RTL-SDR style, zero at bias):
+ * float = (byte - bias) / scalar and byte = float * scalar + bias.
+ */
+void convert_8u_to_32f(float *out, const uint8_t *in, float scalar, float bias,
+                       size_t num_points);
+uint64_t convert_32f_to_8u(uint8_t *out, const float *in, float scalar,
+                           float bias, size_t num_points);
+
+/*
+ * Packed formats, both little-endian with I in the low bits:
+ *   SC12: 3 bytes per I/Q pair, I in bits 0-11 and Q in bits 12-23.
+ *   SC4:  1 byte per I/Q pair, I in bits 0-3 and Q in bits 4-7.
+ * num_points counts floats as above and must be even.
+ */
+uint64_t convert_32f_to_sc12(uint8_t *out, const float *in, float scalar,
+                             size_t num_points);
+void convert_sc12_to_32f(float *out, const uint8_t *in, float scalar,
+                         size_t num_points);
+
+uint64_t convert_32f_to_sc4(uint8_t *out, const float *in, float scalar,
+                            size_t num_points);
+void convert_sc4_to_32f(float *out, const uint8_t *in, float scalar,
+                        size_t num_points);
+
+/*
+ * IEEE half precision (FP16) or, with bfloat16 set, bfloat16 values in
+ * host order.  Both round to nearest even.  FP16 only reaches +/-65504,
+ * beyond that gives +/-inf; bfloat16 keeps float's range with 8 bits of
+ * mantissa.
+ */
+void convert_32f_to_16f(uint16_t *out, const float *in, bool bfloat16,
+                        size_t num_points);
+void convert_16f_to_32f(float *out, const uint16_t *in, bool bfloat16,
+                        size_t num_points);
+
+// The scalar versions of the two above, whatever the CPU.  The SIMD paths
+// have to match these bit for bit, which qa_convert_kernels checks.
+void convert_32f_to_16f_reference(uint16_t *out, const float *in,
+                                  bool bfloat16, size_t num_points);
+void convert_16f_to_32f_reference(float *out, const uint16_t *in,
+                                  bool bfloat16, size_t num_points);
+
+/*
+ * Non-temporal output for the conversions to float.  stream_32f copies
+ * with streaming stores (movntps), which go to memory without pulling the
+ * destination into cache, so a large output doesn't evict what the blocks
+ * downstream are working on.  Without AVX2 it's a plain copy.
+ *
+ * convert_32f_output runs convert(dst, begin, n), which writes floats
+ * begin to begin + n of the output to dst, over [begin, end).  With
+ * nontemporal set it goes a chunk at a time into a buffer that stays in
+ * L1, streaming each chunk out, so no kernel needs a streaming version of
+ * its own.  Otherwise dst is just out + begin.  Chunks are an even number
+ * of floats, so they always start on an I value.
+ */
+#define GRNET_STREAM_CHUNK 2048
+
+void stream_32f(float *out, const float *in, size_t num_points);
+
+template <typename F>
+void convert_32f_output(float *out, size_t begin, size_t end,
+                        bool nontemporal, const F &convert) {
+  if (!nontemporal) {
+    convert(out + begin, begin, end - begin);
+    return;
+  }
+
+  alignas(32) float chunk[GRNET_STREAM_CHUNK];
+  for (size_t i = begin; i < end; i += GRNET_STREAM_CHUNK) {
+    size_t n = std::min(end - i, (size_t)GRNET_STREAM_CHUNK);
+    convert(chunk, i, n);
+    stream_32f(out + i, chunk, n);
+  }
+}
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_CONVERT_KERNELS_H */
@@ -0,0 +1,223 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "convert_thread_pool.h"
+#include <gnuradio/thread/thread.h>
+
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace gr {
+namespace grnet {
+
+// Parses a sysfs CPU list such as "0-7,16-23".
+static std::vector<int> parseCpuList(const std::string &list) {
+  std::vector<int> cpus;
+  std::stringstream ss(list);
+  std::string range;
+
+  while (std::getline(ss, range, ',')) {
+    int first, last;
+    char dash;
+    std::stringstream rs(range);
+
+    if (!(rs >> first))
+      continue;
+    if (rs >> dash >> last) {
+      for (int cpu = first; cpu <= last; cpu++)
+        cpus.push_back(cpu);
+    } else {
+      cpus.push_back(first);
+    }
+  }
+
+  return cpus;
+}
+
+convert_thread_pool::convert_thread_pool(int nthreads)
+    : d_generation(0), d_stop(false), d_fn(NULL), d_context(NULL),
+      d_pieces(0), d_node(-1), d_pending(0), d_result(0) {
+  if (nthreads < 1)
+    nthreads = 1;
+
+  d_bounds.resize(nthreads + 1);
+
+  // NUMA layout.  With a single node there's nothing to keep local, so
+  // leave the scheduler alone.
+  DIR *dir = opendir("/sys/devices/system/node");
+  if (dir) {
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+      int node;
+      char extra;
+      if (sscanf(entry->d_name, "node%d%c", &node, &extra) != 1)
+        continue;
+
+      std::ifstream f(std::string("/sys/devices/system/node/") +
+                      entry->d_name + "/cpulist");
+      std::string list;
+      if (!std::getline(f, list))
+        continue;
+
+      if ((int)d_node_cpus.size() <= node)
+        d_node_cpus.resize(node + 1);
+      d_node_cpus[node] = parseCpuList(list);
+
+      for (size_t i = 0; i < d_node_cpus[node].size(); i++) {
+        int cpu = d_node_cpus[node][i];
+        if ((int)d_cpu_node.size() <= cpu)
+          d_cpu_node.resize(cpu + 1, -1);
+        d_cpu_node[cpu] = node;
+      }
+    }
+    closedir(dir);
+  }
+
+  int populated = 0;
+  for (size_t i = 0; i < d_node_cpus.size(); i++) {
+    if (!d_node_cpus[i].empty())
+      populated++;
+  }
+  if (populated < 2) {
+    d_node_cpus.clear();
+    d_cpu_node.clear();
+  }
+
+  for (int i = 1; i < nthreads; i++)
+    d_workers.push_back(new boost::thread(
+        boost::bind(&convert_thread_pool::runWorker, this, i)));
+}
+
+convert_thread_pool::~convert_thread_pool() {
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    d_stop = true;
+  }
+  d_start.notify_all();
+
+  for (size_t i = 0; i < d_workers.size(); i++) {
+    d_workers[i]->join();
+    delete d_workers[i];
+  }
+}
+
+int convert_thread_pool::currentNode() const {
+#ifdef __linux__
+  int cpu = sched_getcpu();
+  if (cpu >= 0 && cpu < (int)d_cpu_node.size())
+    return d_cpu_node[cpu];
+#endif
+  return -1;
+}
+
+void convert_thread_pool::runWorker(int index) {
+  uint64_t generation = 0;
+  int boundNode = -1;
+
+  while (true) {
+    job_fn fn;
+    void *context;
+    size_t begin, end;
+    int node;
+
+    {
+      boost::mutex::scoped_lock lock(d_mutex);
+      while (!d_stop && d_generation == generation)
+        d_start.wait(lock);
+
+      if (d_stop)
+        return;
+
+      generation = d_generation;
+      if (index >= d_pieces)
+        continue; // Not needed for this one
+
+      fn = d_fn;
+      context = d_context;
+      begin = d_bounds[index];
+      end = d_bounds[index + 1];
+      node = d_node;
+    }
+
+    if (node >= 0 && node != boundNode) {
+      gr::thread::thread_bind_to_processor(d_node_cpus[node]);
+      boundNode = node;
+    }
+
+    if (begin < end)
+      d_result += fn(context, begin, end);
+
+    boost::mutex::scoped_lock lock(d_mutex);
+    if (--d_pending == 0)
+      d_done.notify_one();
+  }
+}
+
+uint64_t convert_thread_pool::run(size_t n, size_t granularity,
+                                  size_t minPiece, job_fn fn, void *context) {
+  size_t pieces = std::min((size_t)nthreads(), n / std::max(minPiece,
+                                                            (size_t)1));
+  if (pieces <= 1)
+    return fn(context, 0, n);
+
+  // Equal pieces, rounded up to the granularity, so all but the last
+  // start on a granularity boundary.
+  granularity = std::max(granularity, (size_t)1);
+  size_t per = (n + pieces - 1) / pieces;
+  per = (per + granularity - 1) / granularity * granularity;
+
+  {
+    boost::mutex::scoped_lock lock(d_mutex);
+    for (size_t i = 0; i <= pieces; i++)
+      d_bounds[i] = std::min(n, i * per);
+
+    d_fn = fn;
+    d_context = context;
+    d_pieces = (int)pieces;
+    d_pending = (int)pieces - 1;
+    d_node = d_cpu_node.empty() ? -1 : currentNode();
+    d_result = 0;
+    d_generation++;
+  }
+  d_start.notify_all();
+
+  uint64_t result = fn(context, d_bounds[0], d_bounds[1]);
+
+  boost::mutex::scoped_lock lock(d_mutex);
+  while (d_pending > 0)
+    d_done.wait(lock);
+
+  return result + d_result.load();
+}
+
+} // namespace grnet
+} // namespace gr
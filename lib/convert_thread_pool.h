@@ -0,0 +1,118 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_CONVERT_THREAD_POOL_H
+#define INCLUDED_GRNET_CONVERT_THREAD_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <vector>
+
+// Smallest piece of output, in bytes, worth handing to another thread.
+// Below this the wakeup costs more than the extra core saves, and the
+// data is likely still in cache anyway.  A call needs two of these to
+// use a second thread, well past the default GNU Radio buffer, so the
+// blocks set an output multiple and minimum buffer to match.
+#define CONVERT_POOL_MIN_PIECE_BYTES (128 * 1024)
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Small persistent pool for splitting one conversion across cores.
+ *
+ * run() cuts [0, n) into one contiguous piece per thread, each a multiple
+ * of granularity, hands all but the first to the workers and does the
+ * first on the calling thread, then waits for the rest.  The workers are
+ * created once, with the pool, and sleep in between calls.
+ *
+ * The block's buffers are first touched by the block's own thread, so
+ * on a NUMA machine they live on that thread's node.  Each call notes the
+ * node the caller is running on, and the workers bind themselves to that
+ * node's CPUs (all of them, not one core each) before taking their piece,
+ * so the reads and writes stay local.  Where the node layout isn't
+ * available (non-Linux, or no /sys/devices/system/node) nothing is
+ * bound.
+ */
+class convert_thread_pool {
+public:
+  typedef uint64_t (*job_fn)(void *context, size_t begin, size_t end);
+
+private:
+  std::vector<boost::thread *> d_workers;
+  std::vector<std::vector<int>> d_node_cpus; // Per NUMA node
+  std::vector<int> d_cpu_node;                // CPU number -> node
+
+  boost::mutex d_mutex;
+  boost::condition_variable d_start;
+  boost::condition_variable d_done;
+  uint64_t d_generation;
+  bool d_stop;
+
+  // The current job, set by run() under d_mutex.
+  job_fn d_fn;
+  void *d_context;
+  std::vector<size_t> d_bounds; // Piece i is [d_bounds[i], d_bounds[i+1])
+  int d_pieces;                 // Pieces in use, including the caller's
+  int d_node;                   // Caller's NUMA node, -1 if unknown
+  int d_pending;                // Worker pieces not finished yet
+  std::atomic<uint64_t> d_result;
+
+  void runWorker(int index);
+  int currentNode() const;
+
+  template <typename F>
+  static uint64_t call(void *context, size_t begin, size_t end) {
+    return (*(F *)context)(begin, end);
+  }
+
+  uint64_t run(size_t n, size_t granularity, size_t minPiece, job_fn fn,
+               void *context);
+
+public:
+  // nthreads counts the calling thread, so nthreads - 1 workers are
+  // started.
+  convert_thread_pool(int nthreads);
+  ~convert_thread_pool();
+
+  int nthreads() const { return (int)d_workers.size() + 1; }
+
+  /*
+   * Calls f(begin, end) over pieces of [0, n) in parallel and returns the
+   * sum of what they return.  Pieces are multiples of granularity (except
+   * the last) and at least minPiece long, so a small n uses fewer
+   * threads, down to just the caller.  f must stay valid until run()
+   * returns, which it does.
+   */
+  template <typename F>
+  uint64_t run(size_t n, size_t granularity, size_t minPiece, F &f) {
+    return run(n, granularity, minPiece, &call<F>, (void *)&f);
+  }
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_CONVERT_THREAD_POOL_H */
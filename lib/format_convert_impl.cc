@@ -0,0 +1,154 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "format_convert_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+format_convert::sptr format_convert::make(int inputFormat, int outputFormat,
+                                          bool bigEndian, float scale,
+                                          int vlen, int nthreads,
+                                          size_t nontemporalThreshold) {
+  return gnuradio::get_initial_sptr(
+      new format_convert_impl(inputFormat, outputFormat, bigEndian, scale,
+                              vlen, nthreads, nontemporalThreshold));
+}
+
+// Item size for the io signatures.  Bad arguments are reported by the
+// constructor, so this only has to not fall over on them.
+static size_t item_size(int format, int vlen) {
+  const format_converter::format_info *info = format_converter::info(format);
+  return info ? info->sample_size * std::max(vlen, 1) : 1;
+}
+
+/*
+ * The private constructor
+ */
+format_convert_impl::format_convert_impl(int inputFormat, int outputFormat,
+                                         bool bigEndian, float scale,
+                                         int vlen, int nthreads,
+                                         size_t nontemporalThreshold)
+    : gr::sync_block(
+          "format_convert",
+          gr::io_signature::make(1, 1, item_size(inputFormat, vlen)),
+          gr::io_signature::make(1, 1, item_size(outputFormat, vlen))),
+      d_converter(NULL), d_saturated(0), d_pool(NULL),
+      d_nontemporalThreshold(nontemporalThreshold) {
+  if (!format_converter::info(inputFormat))
+    throw std::runtime_error("[Format Convert] Unknown input format.");
+
+  if (!format_converter::info(outputFormat))
+    throw std::runtime_error("[Format Convert] Unknown output format.");
+
+  if (bigEndian && inputFormat != SAMPLEFORMAT_SC16 &&
+      outputFormat != SAMPLEFORMAT_SC16)
+    throw std::runtime_error(
+        "[Format Convert] Big-endian byte order only applies to SC16.");
+
+  if (!(scale > 0.0f))
+    throw std::runtime_error("[Format Convert] Scale must be positive.");
+
+  if (vlen < 1)
+    throw std::runtime_error("[Format Convert] Vector length must be at "
+                             "least 1.");
+
+  d_converter = new format_converter(inputFormat, outputFormat, bigEndian,
+                                     scale, vlen);
+
+  if (outputFormat == SAMPLEFORMAT_FC32) {
+    const int alignment_multiple =
+        volk_get_alignment() / d_converter->output_size();
+    set_alignment(std::max(1, alignment_multiple));
+  }
+
+  if (nthreads > 1) {
+    d_pool = new convert_thread_pool(nthreads);
+    for (int i = 0; i < nthreads; i++)
+      d_thread_converters.push_back(new format_converter(
+          inputFormat, outputFormat, bigEndian, scale, vlen));
+
+    // Calls from the default buffers are too short to split, so take
+    // whole pieces and keep enough buffer for each thread to get one.
+    int piece = std::max(CONVERT_POOL_MIN_PIECE_BYTES /
+                             d_converter->output_size(),
+                         (size_t)1);
+    set_output_multiple(piece);
+    set_min_output_buffer(2 * nthreads * piece);
+  }
+}
+
+/*
+ * Our virtual destructor.
+ */
+format_convert_impl::~format_convert_impl() {
+  delete d_pool;
+
+  for (size_t i = 0; i < d_thread_converters.size(); i++)
+    delete d_thread_converters[i];
+
+  delete d_converter;
+}
+
+int format_convert_impl::work(int noutput_items,
+                              gr_vector_const_void_star &input_items,
+                              gr_vector_void_star &output_items) {
+  uint64_t clipped;
+  bool nontemporal = d_nontemporalThreshold &&
+                     noutput_items * d_converter->output_size() >=
+                         d_nontemporalThreshold;
+
+  if (d_pool) {
+    const uint8_t *in = (const uint8_t *)input_items[0];
+    uint8_t *out = (uint8_t *)output_items[0];
+    size_t inSize = d_converter->input_size();
+    size_t outSize = d_converter->output_size();
+
+    // Each piece runs on a different thread, so a counter is enough to
+    // give each one a converter of its own.
+    std::atomic<size_t> next(0);
+    auto convert = [&](size_t begin, size_t end) -> uint64_t {
+      format_converter *c = d_thread_converters[next++];
+      return c->convert(out + begin * outSize, in + begin * inSize,
+                        end - begin, nontemporal);
+    };
+
+    size_t piece =
+        std::max(CONVERT_POOL_MIN_PIECE_BYTES / outSize, (size_t)1);
+    clipped = d_pool->run(noutput_items, 64, piece, convert);
+  } else {
+    clipped = d_converter->convert(output_items[0], input_items[0],
+                                   noutput_items, nontemporal);
+  }
+
+  if (clipped)
+    d_saturated += clipped;
+
+  return noutput_items;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
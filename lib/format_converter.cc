@@ -0,0 +1,273 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "format_converter.h"
+#include "convert_kernels.h"
+#include <grnet/format_convert.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <volk/volk.h>
+
+namespace gr {
+namespace grnet {
+
+// Floats per chunk when converting between two non-float formats: 32 KB of
+// scratch, which stays in cache between the two passes.
+#define FORMAT_CONVERTER_CHUNK 8192
+
+/*
+ * Scaling a float buffer.  volk handles the ISA choice, including NEON.
+ */
+static void scale_32f(float *out, const float *in, float scalar,
+                      size_t num_points) {
+  if (scalar == 1.0f) {
+    if (out != in)
+      memcpy(out, in, num_points * sizeof(float));
+  } else {
+    volk_32f_s32f_multiply_32f(out, in, scalar, num_points);
+  }
+}
+
+template <int F> struct sample_format;
+
+template <> struct sample_format<SAMPLEFORMAT_FC32> {
+  static const char *name() { return "FC32"; }
+  static size_t size() { return sizeof(float) * 2; }
+  static float full_scale() { return 1.0f; }
+
+  static void to_float(float *out, const void *in, float scalar, bool,
+                       size_t num_points) {
+    scale_32f(out, (const float *)in, 1.0f / scalar, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar, bool,
+                             size_t num_points) {
+    scale_32f((float *)out, in, scalar, num_points);
+    return 0;
+  }
+};
+
+template <> struct sample_format<SAMPLEFORMAT_SC16> {
+  static const char *name() { return "SC16"; }
+  static size_t size() { return sizeof(int16_t) * 2; }
+  static float full_scale() { return SHRT_MAX; }
+
+  static void to_float(float *out, const void *in, float scalar,
+                       bool bigEndian, size_t num_points) {
+    if (bigEndian)
+      convert_16i_be_to_32f(out, (const int16_t *)in, scalar, num_points);
+    else
+      volk_16i_s32f_convert_32f(out, (const int16_t *)in, scalar, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar,
+                             bool bigEndian, size_t num_points) {
+    return convert_32f_to_16i((int16_t *)out, in, scalar, gr_complex(0, 0),
+                              bigEndian, num_points);
+  }
+};
+
+template <> struct sample_format<SAMPLEFORMAT_SC8> {
+  static const char *name() { return "SC8"; }
+  static size_t size() { return sizeof(int8_t) * 2; }
+  static float full_scale() { return SCHAR_MAX; }
+
+  static void to_float(float *out, const void *in, float scalar, bool,
+                       size_t num_points) {
+    volk_8i_s32f_convert_32f(out, (const int8_t *)in, scalar, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar, bool,
+                             size_t num_points) {
+    return convert_32f_to_8i((int8_t *)out, in, scalar, gr_complex(0, 0),
+                             num_points);
+  }
+};
+
+template <> struct sample_format<SAMPLEFORMAT_SU8> {
+  static const char *name() { return "SU8"; }
+  static size_t size() { return sizeof(uint8_t) * 2; }
+  static float full_scale() { return 127.5f; }
+
+  static void to_float(float *out, const void *in, float scalar, bool,
+                       size_t num_points) {
+    convert_8u_to_32f(out, (const uint8_t *)in, scalar, 127.5f, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar, bool,
+                             size_t num_points) {
+    return convert_32f_to_8u((uint8_t *)out, in, scalar, 127.5f, num_points);
+  }
+};
+
+template <> struct sample_format<SAMPLEFORMAT_SC12> {
+  static const char *name() { return "SC12"; }
+  static size_t size() { return 3; }
+  static float full_scale() { return 2047.0f; }
+
+  static void to_float(float *out, const void *in, float scalar, bool,
+                       size_t num_points) {
+    convert_sc12_to_32f(out, (const uint8_t *)in, scalar, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar, bool,
+                             size_t num_points) {
+    return convert_32f_to_sc12((uint8_t *)out, in, scalar, num_points);
+  }
+};
+
+template <> struct sample_format<SAMPLEFORMAT_SC4> {
+  static const char *name() { return "SC4"; }
+  static size_t size() { return 1; }
+  static float full_scale() { return 7.0f; }
+
+  static void to_float(float *out, const void *in, float scalar, bool,
+                       size_t num_points) {
+    convert_sc4_to_32f(out, (const uint8_t *)in, scalar, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar, bool,
+                             size_t num_points) {
+    return convert_32f_to_sc4((uint8_t *)out, in, scalar, num_points);
+  }
+};
+
+// FP16 and bfloat16 are the same apart from the flag to the kernels.  The
+// kernels don't scale, so that's a separate pass when scale isn't 1.
+template <bool BF16> struct sample_format_16f {
+  static size_t size() { return sizeof(uint16_t) * 2; }
+  static float full_scale() { return 1.0f; }
+
+  static void to_float(float *out, const void *in, float scalar, bool,
+                       size_t num_points) {
+    convert_16f_to_32f(out, (const uint16_t *)in, BF16, num_points);
+    scale_32f(out, out, 1.0f / scalar, num_points);
+  }
+  static uint64_t from_float(void *out, const float *in, float scalar, bool,
+                             size_t num_points) {
+    uint16_t *o = (uint16_t *)out;
+    if (scalar == 1.0f) {
+      convert_32f_to_16f(o, in, BF16, num_points);
+      return 0;
+    }
+
+    alignas(32) float scaled[1024];
+    while (num_points > 0) {
+      size_t n = std::min(num_points, (size_t)1024);
+      scale_32f(scaled, in, scalar, n);
+      convert_32f_to_16f(o, scaled, BF16, n);
+      o += n;
+      in += n;
+      num_points -= n;
+    }
+    return 0;
+  }
+};
+
+template <>
+struct sample_format<SAMPLEFORMAT_FP16> : public sample_format_16f<false> {
+  static const char *name() { return "FP16"; }
+};
+
+template <>
+struct sample_format<SAMPLEFORMAT_BF16> : public sample_format_16f<true> {
+  static const char *name() { return "BF16"; }
+};
+
+template <int F> static format_converter::format_info make_info() {
+  format_converter::format_info info = {
+      sample_format<F>::name(), sample_format<F>::size(),
+      sample_format<F>::full_scale(), &sample_format<F>::to_float,
+      &sample_format<F>::from_float};
+  return info;
+}
+
+const format_converter::format_info *format_converter::info(int format) {
+  // Indexed by SAMPLEFORMAT_*
+  static const format_info formats[] = {
+      make_info<SAMPLEFORMAT_FC32>(), make_info<SAMPLEFORMAT_SC16>(),
+      make_info<SAMPLEFORMAT_SC8>(),  make_info<SAMPLEFORMAT_SU8>(),
+      make_info<SAMPLEFORMAT_SC12>(), make_info<SAMPLEFORMAT_SC4>(),
+      make_info<SAMPLEFORMAT_FP16>(), make_info<SAMPLEFORMAT_BF16>()};
+
+  if (format < 0 || format >= (int)(sizeof(formats) / sizeof(formats[0])))
+    return NULL;
+
+  return &formats[format];
+}
+
+format_converter::format_converter(int inputFormat, int outputFormat,
+                                   bool bigEndian, float scale, size_t vlen)
+    : d_in(info(inputFormat)), d_out(info(outputFormat)),
+      d_from_float(inputFormat == SAMPLEFORMAT_FC32),
+      d_to_float(outputFormat == SAMPLEFORMAT_FC32), d_bigEndian(bigEndian),
+      d_vlen(vlen) {
+  // A float output is written by to_float directly, so the gain goes on
+  // the input side.  Otherwise it goes on from_float, and to_float just
+  // normalizes.
+  if (d_to_float) {
+    d_in_scalar = d_in->full_scale / scale;
+    d_out_scalar = 1.0f;
+  } else {
+    d_in_scalar = d_in->full_scale;
+    d_out_scalar = d_out->full_scale * scale;
+  }
+
+  if (!d_from_float && !d_to_float)
+    d_scratch.resize(FORMAT_CONVERTER_CHUNK);
+}
+
+uint64_t format_converter::convert(void *out, const void *in, size_t nitems,
+                                   bool nontemporal) {
+  size_t num_points = nitems * d_vlen * 2;
+
+  if (d_to_float) {
+    auto convert = [&](float *dst, size_t begin, size_t n) {
+      d_in->to_float(dst, (const uint8_t *)in + begin / 2 * d_in->sample_size,
+                     d_in_scalar, d_bigEndian, n);
+    };
+    convert_32f_output((float *)out, 0, num_points, nontemporal, convert);
+    return 0;
+  }
+
+  if (d_from_float)
+    return d_out->from_float(out, (const float *)in, d_out_scalar,
+                             d_bigEndian, num_points);
+
+  const uint8_t *i = (const uint8_t *)in;
+  uint8_t *o = (uint8_t *)out;
+  float *scratch = &d_scratch[0];
+  uint64_t clipped = 0;
+
+  while (num_points > 0) {
+    size_t n = std::min(num_points, d_scratch.size());
+    d_in->to_float(scratch, i, d_in_scalar, d_bigEndian, n);
+    clipped += d_out->from_float(o, scratch, d_out_scalar, d_bigEndian, n);
+
+    i += n / 2 * d_in->sample_size;
+    o += n / 2 * d_out->sample_size;
+    num_points -= n;
+  }
+
+  return clipped;
+}
+
+} // namespace grnet
+} // namespace gr
@@ -0,0 +1,98 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_FORMAT_CONVERTER_H
+#define INCLUDED_GRNET_FORMAT_CONVERTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Conversion between any two SAMPLEFORMAT_* formats (see
+ * grnet/format_convert.h).
+ *
+ * Every format is described once, by a sample_format<> specialization
+ * giving its size, its native full scale and a to_float/from_float pair
+ * on top of the convert_kernels or volk routines.  The table of those is
+ * built from the template, and the converter just picks the two entries
+ * it needs when it's constructed.  The ISA choice is made inside the
+ * kernels (once per process, on first use), so there's no per-call
+ * dispatch beyond the two function pointers.
+ *
+ * When either side is complex float the conversion is a single pass
+ * straight from the input to the output.  Between two other formats it
+ * goes through a float scratch buffer a chunk at a time, sized to stay in
+ * L1/L2.
+ */
+class format_converter {
+public:
+  // num_points counts scalar values (2 per complex sample), as in
+  // convert_kernels.
+  typedef void (*to_float_fn)(float *out, const void *in, float scalar,
+                              bool bigEndian, size_t num_points);
+  typedef uint64_t (*from_float_fn)(void *out, const float *in, float scalar,
+                                    bool bigEndian, size_t num_points);
+
+  struct format_info {
+    const char *name;
+    size_t sample_size; // Bytes per complex sample
+    float full_scale;
+    to_float_fn to_float;
+    from_float_fn from_float;
+  };
+
+  // NULL for an unknown format.
+  static const format_info *info(int format);
+
+private:
+  const format_info *d_in;
+  const format_info *d_out;
+  bool d_from_float; // Input is complex float
+  bool d_to_float;   // Output is complex float
+  bool d_bigEndian;
+  float d_in_scalar;  // to_float: float = in / d_in_scalar
+  float d_out_scalar; // from_float: out = float * d_out_scalar
+  size_t d_vlen;
+  std::vector<float> d_scratch;
+
+public:
+  // Formats must be valid (info() != NULL).
+  format_converter(int inputFormat, int outputFormat, bool bigEndian,
+                   float scale, size_t vlen);
+
+  size_t input_size() const { return d_in->sample_size * d_vlen; }
+  size_t output_size() const { return d_out->sample_size * d_vlen; }
+
+  // Converts nitems items of vlen samples, returning how many values were
+  // clipped.  nontemporal writes a complex float output with streaming
+  // stores (see convert_32f_output); other outputs ignore it.
+  uint64_t convert(void *out, const void *in, size_t nitems,
+                   bool nontemporal = false);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_FORMAT_CONVERTER_H */
@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "int_fir_decimator.h"
+#include "convert_kernels.h"
+
+#include <cmath>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRNET_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace gr {
+namespace grnet {
+
+template <typename T> static inline T saturate(int32_t v) {
+  if (v > std::numeric_limits<T>::max())
+    return std::numeric_limits<T>::max();
+  if (v < std::numeric_limits<T>::min())
+    return std::numeric_limits<T>::min();
+  return (T)v;
+}
+
+template <typename T>
+static void filter_generic(T *out, const T *in, const int16_t *taps,
+                           size_t ntaps, int decimation, int shift,
+                           size_t noutputs) {
+  const int32_t round = shift ? 1 << (shift - 1) : 0;
+
+  for (size_t n = 0; n < noutputs; n++, in += 2 * decimation) {
+    int32_t accI = 0;
+    int32_t accQ = 0;
+
+    for (size_t k = 0; k < ntaps; k++) {
+      accI += (int32_t)taps[k] * in[2 * k];
+      accQ += (int32_t)taps[k] * in[2 * k + 1];
+    }
+
+    *out++ = saturate<T>((accI + round) >> shift);
+    *out++ = saturate<T>((accQ + round) >> shift);
+  }
+}
+
+#ifdef GRNET_X86_KERNELS
+// 8 I/Q pairs widened to int16 as needed
+__attribute__((target("avx2"))) static inline __m256i
+load_pairs(const int16_t *p) {
+  return _mm256_loadu_si256((const __m256i *)p);
+}
+
+__attribute__((target("avx2"))) static inline __m256i
+load_pairs(const int8_t *p) {
+  return _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)p));
+}
+
+template <typename T>
+__attribute__((target("avx2"))) static void
+filter_avx2(T *out, const T *in, const int16_t *taps2, size_t ntaps,
+            int decimation, int shift, size_t noutputs) {
+  // I0 Q0 I1 Q1 -> I0 I1 Q0 Q1, so pmaddwd against h0 h1 h0 h1 gives the
+  // I and Q partial sums in alternate dwords.
+  const __m256i order =
+      _mm256_setr_epi8(0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15,
+                       0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15);
+  const __m128i round = _mm_set1_epi32(shift ? 1 << (shift - 1) : 0);
+  const __m128i vshift = _mm_cvtsi32_si128(shift);
+
+  for (size_t n = 0; n < noutputs; n++, in += 2 * decimation) {
+    __m256i acc = _mm256_setzero_si256();
+
+    for (size_t k = 0; k < ntaps; k += 8) {
+      __m256i v = _mm256_shuffle_epi8(load_pairs(in + 2 * k), order);
+      __m256i h = _mm256_loadu_si256((const __m256i *)(taps2 + 2 * k));
+      acc = _mm256_add_epi32(acc, _mm256_madd_epi16(v, h));
+    }
+
+    // I Q I Q | I Q I Q -> I Q
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc),
+                                _mm256_extracti128_si256(acc, 1));
+    sum = _mm_add_epi32(sum, _mm_srli_si128(sum, 8));
+    sum = _mm_sra_epi32(_mm_add_epi32(sum, round), vshift);
+
+    *out++ = saturate<T>(_mm_cvtsi128_si32(sum));
+    *out++ = saturate<T>(_mm_extract_epi32(sum, 1));
+  }
+}
+#endif
+
+int int_fir_decimator::tap_shift(const std::vector<float> &taps,
+                                 int inputBits) {
+  // Full scale input magnitude, and the most the accumulator can take
+  // (leaving room for the rounding constant).
+  const int64_t input_max = (int64_t)1 << (inputBits - 1);
+  const int64_t acc_max = std::numeric_limits<int32_t>::max() - (1 << 15);
+
+  for (int shift = 15; shift >= 0; shift--) {
+    int64_t sum = 0;
+    bool fits = true;
+
+    for (size_t i = 0; i < taps.size() && fits; i++) {
+      long q = lrintf(ldexpf(taps[i], shift));
+      if (q > std::numeric_limits<int16_t>::max() ||
+          q < -std::numeric_limits<int16_t>::max())
+        fits = false;
+      sum += q < 0 ? -q : q;
+    }
+
+    if (fits && sum * input_max <= acc_max)
+      return shift;
+  }
+
+  return -1;
+}
+
+int_fir_decimator::int_fir_decimator(int decimation,
+                                     const std::vector<float> &taps,
+                                     int inputBits)
+    : d_decimation(decimation), d_shift(tap_shift(taps, inputBits)),
+      d_ntaps((taps.size() + 7) & ~(size_t)7), d_avx2(cpu_has_avx2()) {
+  // Reverse so the taps line up with the samples oldest first, padding
+  // with zeros at the old end.
+  d_taps.assign(d_ntaps, 0);
+  for (size_t i = 0; i < taps.size(); i++)
+    d_taps[d_ntaps - 1 - i] = (int16_t)lrintf(ldexpf(taps[i], d_shift));
+
+  d_taps2.resize(2 * d_ntaps);
+  for (size_t k = 0; k < d_ntaps; k += 2) {
+    d_taps2[2 * k] = d_taps[k];
+    d_taps2[2 * k + 1] = d_taps[k + 1];
+    d_taps2[2 * k + 2] = d_taps[k];
+    d_taps2[2 * k + 3] = d_taps[k + 1];
+  }
+}
+
+void int_fir_decimator::filter(int16_t *out, const int16_t *in,
+                               size_t noutputs) const {
+#ifdef GRNET_X86_KERNELS
+  if (d_avx2) {
+    filter_avx2(out, in, &d_taps2[0], d_ntaps, d_decimation, d_shift,
+                noutputs);
+    return;
+  }
+#endif
+  filter_generic(out, in, &d_taps[0], d_ntaps, d_decimation, d_shift,
+                 noutputs);
+}
+
+void int_fir_decimator::filter(int8_t *out, const int8_t *in,
+                               size_t noutputs) const {
+#ifdef GRNET_X86_KERNELS
+  if (d_avx2) {
+    filter_avx2(out, in, &d_taps2[0], d_ntaps, d_decimation, d_shift,
+                noutputs);
+    return;
+  }
+#endif
+  filter_generic(out, in, &d_taps[0], d_ntaps, d_decimation, d_shift,
+                 noutputs);
+}
+
+} // namespace grnet
+} // namespace gr
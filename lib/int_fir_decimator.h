@@ -0,0 +1,78 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_INT_FIR_DECIMATOR_H
+#define INCLUDED_GRNET_INT_FIR_DECIMATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Decimating FIR filter with real taps for interleaved int8 or int16 I/Q,
+ * done entirely in integer arithmetic.
+ *
+ * The taps are quantized to int16 with a power of two scale, the largest
+ * that keeps every tap in range and leaves enough headroom that the int32
+ * accumulator can't overflow for full scale input.  Outputs are rounded
+ * back down by the same shift and saturated to the input type.  Only the
+ * kept outputs are computed (one dot product every decimation inputs).
+ *
+ * The tap count is padded up to a multiple of 8 with zeros on the old end,
+ * so the filter needs ntaps() - 1 samples of history.  filter() reads from
+ * in, which points at the oldest sample needed for the first output, and
+ * output n is computed from the ntaps() samples starting at
+ * in[n * decimation].  The AVX2 version shuffles the samples into I/I and
+ * Q/Q pairs for pmaddwd; results are identical to the scalar version.
+ */
+class int_fir_decimator {
+private:
+  int d_decimation;
+  int d_shift;
+  size_t d_ntaps;
+  std::vector<int16_t> d_taps;  // Time reversed: d_taps[0] is the oldest
+  std::vector<int16_t> d_taps2; // Pairs laid out for pmaddwd
+  bool d_avx2;
+
+public:
+  // The quantization shift for the given taps and input size (8 or 16
+  // bits), or -1 if the taps are too large to represent.
+  static int tap_shift(const std::vector<float> &taps, int inputBits);
+
+  // tap_shift() must be >= 0 for these taps.
+  int_fir_decimator(int decimation, const std::vector<float> &taps,
+                    int inputBits);
+
+  size_t ntaps() const { return d_ntaps; }
+  int shift() const { return d_shift; }
+
+  // noutputs complex samples from interleaved I/Q
+  void filter(int16_t *out, const int16_t *in, size_t noutputs) const;
+  void filter(int8_t *out, const int8_t *in, size_t noutputs) const;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_INT_FIR_DECIMATOR_H */
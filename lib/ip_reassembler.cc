@@ -0,0 +1,187 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "ip_reassembler.h"
+
+#include <string.h>
+
+namespace gr {
+namespace grnet {
+
+ip_reassembler::ip_reassembler(size_t slots, uint64_t timeout_ns)
+    : d_slots(slots), d_arena(slots * IPREASM_MAX_DATAGRAM),
+      d_timeout_ns(timeout_ns), d_active(0), d_returned(-1), d_completed(0),
+      d_incomplete(0) {
+  for (size_t i = 0; i < slots; i++) {
+    d_slots[i].used = false;
+    d_slots[i].data = &d_arena[i * IPREASM_MAX_DATAGRAM];
+  }
+}
+
+void ip_reassembler::release(slot &s) {
+  s.used = false;
+  d_active--;
+}
+
+void ip_reassembler::expire(uint64_t ts_ns) {
+  for (size_t i = 0; i < d_slots.size() && d_active > 0; i++) {
+    slot &s = d_slots[i];
+
+    if (s.used && ts_ns > s.first_ts && ts_ns - s.first_ts > d_timeout_ns) {
+      release(s);
+      d_incomplete++;
+    }
+  }
+}
+
+ip_reassembler::slot *
+ip_reassembler::find(const pcap_udp_parser::ip_fragment &frag,
+                     uint64_t ts_ns) {
+  slot *freeSlot = NULL;
+  slot *oldest = NULL;
+
+  for (size_t i = 0; i < d_slots.size(); i++) {
+    slot &s = d_slots[i];
+
+    if (!s.used) {
+      if (freeSlot == NULL)
+        freeSlot = &s;
+      continue;
+    }
+
+    if (s.id == frag.id && s.src == frag.src && s.dst == frag.dst &&
+        s.proto == frag.proto)
+      return &s;
+
+    if (oldest == NULL || s.first_ts < oldest->first_ts)
+      oldest = &s;
+  }
+
+  if (freeSlot == NULL) {
+    // Everything is busy: give up on the oldest datagram.
+    release(*oldest);
+    d_incomplete++;
+    freeSlot = oldest;
+  }
+
+  freeSlot->used = true;
+  freeSlot->src = frag.src;
+  freeSlot->dst = frag.dst;
+  freeSlot->id = frag.id;
+  freeSlot->proto = frag.proto;
+  freeSlot->first_ts = ts_ns;
+  freeSlot->total_len = 0;
+  freeSlot->max_end = 0;
+  freeSlot->blocks_filled = 0;
+  memset(freeSlot->blocks, 0, sizeof(freeSlot->blocks));
+  d_active++;
+
+  return freeSlot;
+}
+
+bool ip_reassembler::add(const pcap_udp_parser::ip_fragment &frag,
+                         uint64_t ts_ns, const uint8_t *&data, size_t &len) {
+  if (d_returned >= 0) {
+    release(d_slots[d_returned]);
+    d_returned = -1;
+  }
+
+  if (d_active > 0)
+    expire(ts_ns);
+
+  uint32_t end = frag.offset + frag.len;
+
+  // Every fragment but the last has to be a whole number of blocks.
+  if (frag.len == 0 || end > IPREASM_MAX_DATAGRAM ||
+      (frag.more && (frag.len & 7)))
+    return false;
+
+  slot *s = find(frag, ts_ns);
+
+  // Data past the end of the datagram, or a second "last" fragment that
+  // disagrees with the first, means it can't be put back together.
+  bool corrupt;
+
+  if (!frag.more)
+    corrupt = (s->total_len != 0 && s->total_len != end) || s->max_end > end;
+  else
+    corrupt = (s->total_len != 0 && end > s->total_len);
+
+  if (corrupt) {
+    release(*s);
+    d_incomplete++;
+    return false;
+  }
+
+  if (!frag.more)
+    s->total_len = end;
+
+  if (end > s->max_end)
+    s->max_end = end;
+
+  memcpy(&s->data[frag.offset], frag.data, frag.len);
+
+  uint32_t lastBlock = (end + 7) / 8;
+
+  for (uint32_t b = frag.offset / 8; b < lastBlock; b++) {
+    uint64_t bit = 1ULL << (b & 63);
+
+    if (!(s->blocks[b >> 6] & bit)) {
+      s->blocks[b >> 6] |= bit;
+      s->blocks_filled++;
+    }
+  }
+
+  if (s->total_len == 0 || s->blocks_filled != (s->total_len + 7) / 8)
+    return false;
+
+  d_returned = s - &d_slots[0];
+  d_completed++;
+
+  data = s->data;
+  len = s->total_len;
+
+  return true;
+}
+
+size_t ip_reassembler::clear() {
+  size_t dropped = 0;
+
+  if (d_returned >= 0) {
+    release(d_slots[d_returned]);
+    d_returned = -1;
+  }
+
+  for (size_t i = 0; i < d_slots.size(); i++) {
+    if (d_slots[i].used) {
+      release(d_slots[i]);
+      dropped++;
+    }
+  }
+
+  return dropped;
+}
+
+} // namespace grnet
+} // namespace gr
@@ -0,0 +1,108 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_IP_REASSEMBLER_H
+#define INCLUDED_GRNET_IP_REASSEMBLER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "pcap_udp_parser.h"
+
+#define IPREASM_MAX_DATAGRAM 65535
+#define IPREASM_BLOCK_WORDS ((IPREASM_MAX_DATAGRAM / 8 + 64) / 64)
+
+// Datagrams that can be in flight at once, and how long (in capture time)
+// one is given to complete.
+#define IPREASM_DEFAULT_SLOTS 32
+#define IPREASM_DEFAULT_TIMEOUT_NS 1000000000ULL
+
+namespace gr {
+namespace grnet {
+
+/*
+ * IPv4 fragment reassembly for capture replay.
+ *
+ * Datagrams are keyed on (src, dst, id, protocol) and assembled in a slab
+ * of buffers allocated up front, so nothing is allocated per packet.
+ * Coverage is tracked with a bitmap of 8-byte fragment blocks, which makes
+ * out-of-order and duplicated fragments harmless.  A datagram is returned
+ * once the last fragment has been seen and every block before it is
+ * filled.
+ *
+ * A datagram that hasn't completed within the timeout (measured on capture
+ * timestamps, not the wall clock), or that has to be evicted because every
+ * slot is busy, is dropped and counted as incomplete.
+ */
+class ip_reassembler {
+private:
+  struct slot {
+    bool used;
+    uint32_t src;
+    uint32_t dst;
+    uint16_t id;
+    uint8_t proto;
+    uint64_t first_ts;
+    uint32_t total_len; // 0 until the last fragment arrives
+    uint32_t max_end;
+    uint32_t blocks_filled;
+    uint64_t blocks[IPREASM_BLOCK_WORDS];
+    uint8_t *data;
+  };
+
+  std::vector<slot> d_slots;
+  std::vector<uint8_t> d_arena;
+  uint64_t d_timeout_ns;
+  size_t d_active;
+  int d_returned; // slot handed back by the last add(), freed on the next
+
+  std::atomic<uint64_t> d_completed;
+  std::atomic<uint64_t> d_incomplete;
+
+  void release(slot &s);
+  void expire(uint64_t ts_ns);
+  slot *find(const pcap_udp_parser::ip_fragment &frag, uint64_t ts_ns);
+
+public:
+  ip_reassembler(size_t slots = IPREASM_DEFAULT_SLOTS,
+                 uint64_t timeout_ns = IPREASM_DEFAULT_TIMEOUT_NS);
+
+  // Add a fragment captured at ts_ns.  Returns true when it completes a
+  // datagram, with data/len pointing at the reassembled IP payload.  That
+  // buffer stays valid until the next call to add() or clear().
+  bool add(const pcap_udp_parser::ip_fragment &frag, uint64_t ts_ns,
+           const uint8_t *&data, size_t &len);
+
+  // Drop everything in progress, e.g. when the capture is rewound, and
+  // return how many datagrams that was.  They aren't counted as
+  // incomplete: the rewind cut them off, it isn't fragments gone missing.
+  size_t clear();
+
+  uint64_t completed() const { return d_completed.load(); }
+  uint64_t incomplete() const { return d_incomplete.load(); }
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_IP_REASSEMBLER_H */
@@ -0,0 +1,215 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_PACKET_RING_H
+#define INCLUDED_GRNET_PACKET_RING_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Lock-free single-producer/single-consumer queue of packets.
+ *
+ * Packet data lives in one circular arena and the queue itself only holds
+ * small descriptors pointing into it, so the producer copies each payload
+ * once (reserve() + commit()) and the consumer copies it once more straight
+ * to where it's needed (front() + pop()).  A packet is never split across
+ * the end of the arena; if it won't fit in the space left before the end,
+ * it starts again at offset 0.
+ *
+ * Only head/tail indices are shared.  The producer owns d_arena_write, the
+ * consumer publishes d_arena_read so the producer knows what's been freed.
+ */
+class packet_ring {
+public:
+  struct descriptor {
+    uint32_t offset; // Start of the packet in the arena
+    uint32_t len;
+    uint32_t end; // Arena offset the consumer releases up to on pop()
+    uint32_t reserved;
+    uint64_t timestamp_ns; // Capture time, if the producer has one
+  };
+
+private:
+  std::vector<char> d_arena;
+  std::vector<descriptor> d_descs;
+  size_t d_desc_mask;
+
+  // Producer and consumer fields are padded onto separate cache lines.
+  // (Padding rather than alignas, since these get heap allocated and
+  // C++11 new doesn't honour over-alignment.)
+  char d_pad0[64];
+
+  // Producer side
+  std::atomic<size_t> d_head;
+  uint32_t d_arena_write;
+  size_t d_pending_offset;
+
+  char d_pad1[64];
+
+  // Consumer side
+  std::atomic<size_t> d_tail;
+  std::atomic<uint32_t> d_arena_read;
+
+  char d_pad2[64];
+
+  std::atomic<size_t> d_bytes_queued;
+
+public:
+  // descriptors is rounded up to a power of 2.
+  packet_ring(size_t arena_bytes, size_t descriptors)
+      : d_arena(arena_bytes), d_head(0), d_arena_write(0),
+        d_pending_offset(0), d_tail(0), d_arena_read(0), d_bytes_queued(0) {
+    size_t n = 1;
+    while (n < descriptors)
+      n <<= 1;
+
+    d_descs.resize(n);
+    d_desc_mask = n - 1;
+  }
+
+  size_t arena_size() const { return d_arena.size(); }
+
+  /*
+   * Producer: get space for a packet of len bytes.  Returns NULL if the
+   * ring is full (caller backs off and tries again).
+   */
+  char *reserve(size_t len) {
+    size_t head = d_head.load(std::memory_order_relaxed);
+    size_t tail = d_tail.load(std::memory_order_acquire);
+
+    if (head - tail > d_desc_mask)
+      return NULL; // Out of descriptors
+
+    // Loaded after the tail, so it's at least as new as the pop() that
+    // stored that tail.
+    uint32_t read = d_arena_read.load(std::memory_order_acquire);
+    bool empty = (head == tail);
+    size_t cap = d_arena.size();
+
+    if (empty) {
+      // Nothing outstanding, so the whole arena is free.  Start over at 0
+      // to keep big packets from wrapping needlessly.  The pop() that
+      // emptied the ring left d_arena_read at 0 to match, so the checks
+      // below don't see [0, old read) as free once this packet is queued.
+      if (len > cap)
+        return NULL;
+
+      d_pending_offset = 0;
+    } else if (d_arena_write >= read) {
+      // Free space is [write, cap) and [0, read)
+      if (d_arena_write + len <= cap)
+        d_pending_offset = d_arena_write;
+      else if (len < read) // strict, so full never looks like empty
+        d_pending_offset = 0;
+      else
+        return NULL;
+    } else {
+      // Free space is [write, read)
+      if (d_arena_write + len < read)
+        d_pending_offset = d_arena_write;
+      else
+        return NULL;
+    }
+
+    return &d_arena[d_pending_offset];
+  }
+
+  /*
+   * Producer: publish the packet written into the last reserve().
+   */
+  void commit(size_t len, uint64_t timestamp_ns = 0) {
+    size_t head = d_head.load(std::memory_order_relaxed);
+    descriptor &d = d_descs[head & d_desc_mask];
+
+    d.offset = d_pending_offset;
+    d.len = len;
+    d.end = d_pending_offset + len;
+    d.timestamp_ns = timestamp_ns;
+
+    d_arena_write = d.end;
+    d_bytes_queued.fetch_add(len, std::memory_order_relaxed);
+
+    d_head.store(head + 1, std::memory_order_release);
+  }
+
+  /*
+   * Consumer: oldest packet, or NULL if the ring is empty.
+   */
+  const descriptor *front() const {
+    size_t tail = d_tail.load(std::memory_order_relaxed);
+
+    if (tail == d_head.load(std::memory_order_acquire))
+      return NULL;
+
+    return &d_descs[tail & d_desc_mask];
+  }
+
+  const char *data(const descriptor *d) const { return &d_arena[d->offset]; }
+
+  /*
+   * Consumer: release the packet returned by front().
+   */
+  void pop() {
+    size_t tail = d_tail.load(std::memory_order_relaxed);
+    const descriptor &d = d_descs[tail & d_desc_mask];
+    uint32_t end = d.end;
+
+    // Emptying the ring lets the producer restart at 0 (see reserve()),
+    // so move the read offset there too.  If a packet was committed after
+    // the check, a read offset of 0 only stops the producer wrapping until
+    // that packet is popped, which is safe.
+    if (tail + 1 == d_head.load(std::memory_order_acquire))
+      end = 0;
+
+    d_bytes_queued.fetch_sub(d.len, std::memory_order_relaxed);
+    d_arena_read.store(end, std::memory_order_release);
+    d_tail.store(tail + 1, std::memory_order_release);
+  }
+
+  size_t packets_queued() const {
+    return d_head.load(std::memory_order_acquire) -
+           d_tail.load(std::memory_order_acquire);
+  }
+
+  size_t bytes_queued() const {
+    return d_bytes_queued.load(std::memory_order_relaxed);
+  }
+
+  bool empty() const { return packets_queued() == 0; }
+
+  /*
+   * Drop everything.  Only safe while the producer is stopped.
+   */
+  void clear() {
+    while (front())
+      pop();
+  }
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_PACKET_RING_H */
@@ -0,0 +1,525 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcap_file_reader.h"
+
+#include <byteswap.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Classic pcap magic numbers as read in host order
+#define PCAP_MAGIC_US 0xa1b2c3d4
+#define PCAP_MAGIC_NS 0xa1b23c4d
+#define PCAP_MAGIC_US_SWAPPED 0xd4c3b2a1
+#define PCAP_MAGIC_NS_SWAPPED 0x4d3cb2a1
+#define PCAP_FILE_HEADER_SIZE 24
+#define PCAP_RECORD_HEADER_SIZE 16
+
+// pcapng block types
+#define PCAPNG_BT_SHB 0x0A0D0D0A
+#define PCAPNG_BT_IDB 0x00000001
+#define PCAPNG_BT_PB 0x00000002 // Obsolete packet block
+#define PCAPNG_BT_SPB 0x00000003
+#define PCAPNG_BT_EPB 0x00000006
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1A2B3C4D
+#define PCAPNG_OPT_ENDOFOPT 0
+#define PCAPNG_OPT_IF_TSRESOL 9
+
+namespace gr {
+namespace grnet {
+
+pcap_file_reader::pcap_file_reader()
+    : d_fd(-1), d_map(NULL), d_map_size(0), d_offset(0), d_section_offset(0),
+      d_readahead_mark(0), d_swapped(false), d_format(FORMAT_NONE),
+      d_linktype(0), d_nanosecond(false), d_pcap(NULL) {}
+
+pcap_file_reader::~pcap_file_reader() { close(); }
+
+inline uint16_t pcap_file_reader::rd16(const uint8_t *p) const {
+  uint16_t v;
+  memcpy(&v, p, sizeof(v));
+  return d_swapped ? bswap_16(v) : v;
+}
+
+inline uint32_t pcap_file_reader::rd32(const uint8_t *p) const {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return d_swapped ? bswap_32(v) : v;
+}
+
+bool pcap_file_reader::open(const std::string &filename, std::string &err) {
+  close();
+
+  d_filename = filename;
+
+  if (map_file(err))
+    return true;
+
+  // Not something we parse natively.  Let libpcap have a go.
+  return open_libpcap(err);
+}
+
+bool pcap_file_reader::map_file(std::string &err) {
+  d_fd = ::open(d_filename.c_str(), O_RDONLY);
+
+  if (d_fd < 0) {
+    err = strerror(errno);
+    return false;
+  }
+
+  struct stat st;
+
+  if (fstat(d_fd, &st) != 0 || st.st_size < PCAP_FILE_HEADER_SIZE ||
+      (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+    unmap();
+    return false;
+  }
+
+  d_map_size = st.st_size;
+
+  void *map = mmap(NULL, d_map_size, PROT_READ, MAP_PRIVATE, d_fd, 0);
+
+  if (map == MAP_FAILED) {
+    unmap();
+    return false;
+  }
+
+  d_map = (const uint8_t *)map;
+
+  // Playback is front to back.  Let the kernel read ahead aggressively and
+  // drop pages behind us.
+  madvise((void *)d_map, d_map_size, MADV_SEQUENTIAL);
+
+  uint32_t magic;
+  memcpy(&magic, d_map, sizeof(magic));
+
+  switch (magic) {
+  case PCAP_MAGIC_US:
+  case PCAP_MAGIC_NS:
+  case PCAP_MAGIC_US_SWAPPED:
+  case PCAP_MAGIC_NS_SWAPPED:
+    d_format = FORMAT_PCAP;
+    d_swapped = (magic == PCAP_MAGIC_US_SWAPPED ||
+                 magic == PCAP_MAGIC_NS_SWAPPED);
+    d_nanosecond = (magic == PCAP_MAGIC_NS || magic == PCAP_MAGIC_NS_SWAPPED);
+    // Upper bits can carry FCS info
+    d_linktype = rd32(&d_map[20]) & 0x0FFFFFFF;
+    break;
+
+  case PCAPNG_BT_SHB:
+    d_format = FORMAT_PCAPNG;
+    break;
+
+  default:
+    unmap();
+    return false;
+  }
+
+  rewind();
+
+  return true;
+}
+
+bool pcap_file_reader::open_libpcap(std::string &err) {
+  char errbuf[PCAP_ERRBUF_SIZE];
+
+  d_pcap = pcap_open_offline_with_tstamp_precision(
+      d_filename.c_str(), PCAP_TSTAMP_PRECISION_NANO, errbuf);
+
+  if (d_pcap == NULL) {
+    err = errbuf;
+    return false;
+  }
+
+  d_format = FORMAT_LIBPCAP;
+  d_linktype = pcap_datalink(d_pcap);
+
+  return true;
+}
+
+void pcap_file_reader::unmap() {
+  if (d_map) {
+    munmap((void *)d_map, d_map_size);
+    d_map = NULL;
+  }
+
+  if (d_fd >= 0) {
+    ::close(d_fd);
+    d_fd = -1;
+  }
+
+  d_map_size = 0;
+  d_offset = 0;
+  d_format = FORMAT_NONE;
+}
+
+void pcap_file_reader::close() {
+  unmap();
+
+  if (d_pcap) {
+    pcap_close(d_pcap);
+    d_pcap = NULL;
+  }
+
+  d_format = FORMAT_NONE;
+  d_interfaces.clear();
+}
+
+void pcap_file_reader::rewind() {
+  if (d_format == FORMAT_LIBPCAP) {
+    pcap_close(d_pcap);
+    d_pcap = NULL;
+
+    std::string err;
+    open_libpcap(err);
+    return;
+  }
+
+  if (!d_map)
+    return;
+
+  d_offset = (d_format == FORMAT_PCAP) ? PCAP_FILE_HEADER_SIZE : 0;
+  d_section_offset = 0;
+  d_interfaces.clear();
+
+  d_readahead_mark = 0;
+  readahead();
+}
+
+pcap_file_reader::position pcap_file_reader::tell() const {
+  position pos;
+  pos.offset = d_offset;
+  pos.section = d_section_offset;
+  return pos;
+}
+
+bool pcap_file_reader::seek(const position &pos) {
+  if (!d_map || pos.offset > d_map_size || pos.section > pos.offset)
+    return false;
+
+  if (d_format == FORMAT_PCAPNG) {
+    // Pick up the byte order and interfaces of the section: read the SHB
+    // and the IDBs that follow it.  Writers put the IDBs ahead of the
+    // packets that use them, which is all we rely on here.
+    d_offset = pos.section;
+    d_interfaces.clear();
+
+    uint32_t blockType;
+
+    if (d_offset + 12 > d_map_size)
+      return false;
+
+    memcpy(&blockType, &d_map[d_offset], sizeof(blockType));
+
+    if (blockType != PCAPNG_BT_SHB)
+      return false;
+
+    while (d_offset + 12 <= d_map_size && d_offset < pos.offset) {
+      const uint8_t *block = &d_map[d_offset];
+      memcpy(&blockType, block, sizeof(blockType));
+
+      if (blockType == PCAPNG_BT_SHB) {
+        uint32_t bom;
+        memcpy(&bom, &block[8], sizeof(bom));
+
+        if (bom == PCAPNG_BYTE_ORDER_MAGIC)
+          d_swapped = false;
+        else if (bom == bswap_32(PCAPNG_BYTE_ORDER_MAGIC))
+          d_swapped = true;
+        else
+          return false;
+
+        d_section_offset = d_offset;
+      } else {
+        blockType = rd32(block);
+
+        if (blockType != PCAPNG_BT_IDB)
+          break;
+      }
+
+      uint32_t blockLen = rd32(&block[4]);
+
+      if (blockLen < 12 || (blockLen & 3) || blockLen > d_map_size - d_offset)
+        return false;
+
+      if (blockType == PCAPNG_BT_IDB)
+        parse_idb(&block[8], blockLen - 12);
+
+      d_offset += blockLen;
+    }
+  }
+
+  d_offset = pos.offset;
+
+  // Restart the readahead window at the new position.
+  d_readahead_mark = d_offset & ~((size_t)sysconf(_SC_PAGESIZE) - 1);
+  readahead();
+
+  return true;
+}
+
+void pcap_file_reader::readahead() {
+  // Keep a full window requested ahead of the read position.  Windows are
+  // multiples of the page size, so the madvise ranges stay page aligned.
+  while (d_readahead_mark < d_map_size &&
+         d_readahead_mark < d_offset + PCAPREADER_READAHEAD_BYTES) {
+    size_t len = std::min((size_t)PCAPREADER_READAHEAD_BYTES / 4,
+                          d_map_size - d_readahead_mark);
+
+    madvise((void *)&d_map[d_readahead_mark], len, MADV_WILLNEED);
+    d_readahead_mark += len;
+  }
+}
+
+int pcap_file_reader::linktype() const {
+  if (d_format == FORMAT_PCAPNG)
+    return d_interfaces.empty() ? -1 : d_interfaces[0].linktype;
+
+  return d_linktype;
+}
+
+bool pcap_file_reader::next(packet &pkt) {
+  switch (d_format) {
+  case FORMAT_PCAP:
+    return next_pcap(pkt);
+  case FORMAT_PCAPNG:
+    return next_pcapng(pkt);
+  case FORMAT_LIBPCAP:
+    return next_libpcap(pkt);
+  default:
+    return false;
+  }
+}
+
+bool pcap_file_reader::next_pcap(packet &pkt) {
+  if (d_offset + PCAP_RECORD_HEADER_SIZE > d_map_size)
+    return false;
+
+  const uint8_t *rec = &d_map[d_offset];
+  uint32_t tsSec = rd32(&rec[0]);
+  uint32_t tsFrac = rd32(&rec[4]);
+  uint32_t caplen = rd32(&rec[8]);
+
+  // Truncated last record
+  if (caplen > d_map_size - d_offset - PCAP_RECORD_HEADER_SIZE)
+    return false;
+
+  pkt.data = &rec[PCAP_RECORD_HEADER_SIZE];
+  pkt.caplen = caplen;
+  pkt.len = rd32(&rec[12]);
+  pkt.ts_ns = (uint64_t)tsSec * 1000000000ULL +
+              (d_nanosecond ? tsFrac : (uint64_t)tsFrac * 1000ULL);
+  pkt.linktype = d_linktype;
+
+  d_offset += PCAP_RECORD_HEADER_SIZE + caplen;
+
+  if (d_offset + PCAPREADER_READAHEAD_BYTES / 2 > d_readahead_mark)
+    readahead();
+
+  return true;
+}
+
+void pcap_file_reader::parse_idb(const uint8_t *body, size_t bodyLen) {
+  interface_info info;
+  info.linktype = (bodyLen >= 2) ? rd16(body) : 0;
+  info.ts_units_per_sec = 1000000; // pcapng default is microseconds
+
+  // Options follow linktype/reserved/snaplen
+  size_t pos = 8;
+
+  while (pos + 4 <= bodyLen) {
+    uint16_t code = rd16(&body[pos]);
+    uint16_t len = rd16(&body[pos + 2]);
+    pos += 4;
+
+    if (code == PCAPNG_OPT_ENDOFOPT || pos + len > bodyLen)
+      break;
+
+    if (code == PCAPNG_OPT_IF_TSRESOL && len >= 1) {
+      uint8_t resol = body[pos];
+      uint8_t exponent = resol & 0x7F;
+
+      if (resol & 0x80) {
+        // Negative power of 2
+        info.ts_units_per_sec = (exponent < 64) ? (1ULL << exponent) : 0;
+      } else {
+        // Negative power of 10
+        uint64_t units = 1;
+        for (int i = 0; i < exponent && i < 19; i++)
+          units *= 10;
+        info.ts_units_per_sec = units;
+      }
+
+      if (info.ts_units_per_sec == 0)
+        info.ts_units_per_sec = 1000000;
+    }
+
+    pos += (len + 3) & ~3;
+  }
+
+  d_interfaces.push_back(info);
+}
+
+uint64_t pcap_file_reader::pcapng_ts_ns(uint32_t ifId, uint32_t tsHigh,
+                                        uint32_t tsLow) const {
+  uint64_t ts = ((uint64_t)tsHigh << 32) | tsLow;
+  uint64_t units = (ifId < d_interfaces.size())
+                       ? d_interfaces[ifId].ts_units_per_sec
+                       : 1000000;
+
+  if (units == 1000000000ULL)
+    return ts;
+
+  return (ts / units) * 1000000000ULL +
+         (uint64_t)(((unsigned __int128)(ts % units) * 1000000000ULL) / units);
+}
+
+bool pcap_file_reader::next_pcapng(packet &pkt) {
+  while (d_offset + 12 <= d_map_size) {
+    const uint8_t *block = &d_map[d_offset];
+    uint32_t blockType;
+    memcpy(&blockType, block, sizeof(blockType));
+
+    if (blockType == PCAPNG_BT_SHB) {
+      // New section: byte order and interfaces start over.
+      uint32_t bom;
+      memcpy(&bom, &block[8], sizeof(bom));
+
+      if (bom == PCAPNG_BYTE_ORDER_MAGIC)
+        d_swapped = false;
+      else if (bom == bswap_32(PCAPNG_BYTE_ORDER_MAGIC))
+        d_swapped = true;
+      else
+        return false;
+
+      d_interfaces.clear();
+      d_section_offset = d_offset;
+    } else {
+      blockType = rd32(block);
+    }
+
+    uint32_t blockLen = rd32(&block[4]);
+
+    if (blockLen < 12 || (blockLen & 3) || blockLen > d_map_size - d_offset)
+      return false; // Corrupt or truncated
+
+    const uint8_t *body = &block[8];
+    size_t bodyLen = blockLen - 12;
+
+    d_offset += blockLen;
+
+    if (d_offset + PCAPREADER_READAHEAD_BYTES / 2 > d_readahead_mark)
+      readahead();
+
+    switch (blockType) {
+    case PCAPNG_BT_IDB:
+      parse_idb(body, bodyLen);
+      break;
+
+    case PCAPNG_BT_EPB: {
+      if (bodyLen < 20)
+        break;
+
+      uint32_t ifId = rd32(&body[0]);
+      uint32_t caplen = rd32(&body[12]);
+
+      if (caplen > bodyLen - 20)
+        break;
+
+      pkt.data = &body[20];
+      pkt.caplen = caplen;
+      pkt.len = rd32(&body[16]);
+      pkt.ts_ns = pcapng_ts_ns(ifId, rd32(&body[4]), rd32(&body[8]));
+      pkt.linktype =
+          (ifId < d_interfaces.size()) ? d_interfaces[ifId].linktype : 0;
+      return true;
+    }
+
+    case PCAPNG_BT_SPB: {
+      // No timestamp, always interface 0
+      if (bodyLen < 4)
+        break;
+
+      uint32_t len = rd32(&body[0]);
+
+      pkt.data = &body[4];
+      pkt.len = len;
+      pkt.caplen = std::min((size_t)len, bodyLen - 4);
+      pkt.ts_ns = 0;
+      pkt.linktype = d_interfaces.empty() ? 0 : d_interfaces[0].linktype;
+      return true;
+    }
+
+    case PCAPNG_BT_PB: {
+      if (bodyLen < 20)
+        break;
+
+      uint32_t ifId = rd16(&body[0]);
+      uint32_t caplen = rd32(&body[12]);
+
+      if (caplen > bodyLen - 20)
+        break;
+
+      pkt.data = &body[20];
+      pkt.caplen = caplen;
+      pkt.len = rd32(&body[16]);
+      pkt.ts_ns = pcapng_ts_ns(ifId, rd32(&body[4]), rd32(&body[8]));
+      pkt.linktype =
+          (ifId < d_interfaces.size()) ? d_interfaces[ifId].linktype : 0;
+      return true;
+    }
+
+    default:
+      // Name resolution, statistics, custom blocks, ...
+      break;
+    }
+  }
+
+  return false;
+}
+
+bool pcap_file_reader::next_libpcap(packet &pkt) {
+  struct pcap_pkthdr *header;
+  const u_char *data;
+
+  if (!d_pcap || pcap_next_ex(d_pcap, &header, &data) != 1)
+    return false;
+
+  pkt.data = data;
+  pkt.caplen = header->caplen;
+  pkt.len = header->len;
+
+  // Opened with nanosecond precision, so tv_usec holds nanoseconds.
+  pkt.ts_ns = (uint64_t)header->ts.tv_sec * 1000000000ULL + header->ts.tv_usec;
+  pkt.linktype = d_linktype;
+
+  return true;
+}
+
+} // namespace grnet
+} // namespace gr
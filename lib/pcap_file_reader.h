@@ -0,0 +1,140 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_PCAP_FILE_READER_H
+#define INCLUDED_GRNET_PCAP_FILE_READER_H
+
+#include <pcap/pcap.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// How far ahead of the read position we ask the kernel to page in
+#define PCAPREADER_READAHEAD_BYTES (64 * 1024 * 1024)
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Sequential packet reader for capture files.
+ *
+ * Classic pcap (microsecond or nanosecond, either byte order) and pcapng
+ * files are memory-mapped and parsed in place: next() hands back a pointer
+ * into the mapping, so nothing is copied, and rewind() just resets the
+ * read offset.  The mapping is marked MADV_SEQUENTIAL and the kernel is
+ * asked to read ahead in large windows as playback moves through the file.
+ *
+ * Anything we can't map or don't recognize (e.g. a file libpcap can
+ * decompress, or a >4 GB file on a 32-bit system) falls back to libpcap.
+ */
+class pcap_file_reader {
+public:
+  struct packet {
+    const uint8_t *data;
+    uint32_t caplen;
+    uint32_t len;
+    uint64_t ts_ns; // Capture time, UNIX epoch nanoseconds
+    int linktype;   // DLT_* / LINKTYPE_* of the interface it came from
+  };
+
+  // A spot in the file that can be returned to with seek().  For pcapng
+  // the start of the enclosing section is kept too, so the interface
+  // descriptions can be re-read.
+  struct position {
+    uint64_t offset;
+    uint64_t section;
+  };
+
+private:
+  std::string d_filename;
+
+  // mmap backend
+  int d_fd;
+  const uint8_t *d_map;
+  size_t d_map_size;
+  size_t d_offset;
+  size_t d_section_offset; // pcapng: SHB of the current section
+  size_t d_readahead_mark;
+  bool d_swapped;
+
+  enum { FORMAT_NONE, FORMAT_PCAP, FORMAT_PCAPNG, FORMAT_LIBPCAP } d_format;
+
+  // Classic pcap
+  int d_linktype;
+  bool d_nanosecond;
+
+  // pcapng: per-interface link type and timestamp resolution
+  struct interface_info {
+    int linktype;
+    uint64_t ts_units_per_sec;
+  };
+  std::vector<interface_info> d_interfaces;
+
+  // libpcap backend
+  pcap_t *d_pcap;
+
+  inline uint16_t rd16(const uint8_t *p) const;
+  inline uint32_t rd32(const uint8_t *p) const;
+
+  bool map_file(std::string &err);
+  bool open_libpcap(std::string &err);
+  void unmap();
+  void readahead();
+
+  bool next_pcap(packet &pkt);
+  bool next_pcapng(packet &pkt);
+  bool next_libpcap(packet &pkt);
+
+  void parse_idb(const uint8_t *body, size_t bodyLen);
+  uint64_t pcapng_ts_ns(uint32_t ifId, uint32_t tsHigh, uint32_t tsLow) const;
+
+public:
+  pcap_file_reader();
+  ~pcap_file_reader();
+
+  // Returns false (with err set) if the file can't be read at all.
+  bool open(const std::string &filename, std::string &err);
+  void close();
+
+  // Next packet, or false at end of file.  pkt.data stays valid until the
+  // next call to next(), rewind() or close().
+  bool next(packet &pkt);
+
+  // Back to the first packet.
+  void rewind();
+
+  // Where the next packet will be read from, and a jump back there.  Only
+  // mapped files can seek; with the libpcap fallback seek() returns false
+  // and playback has to read through from the start.
+  position tell() const;
+  bool seek(const position &pos);
+
+  bool is_mapped() const { return d_map != NULL; }
+  bool is_open() const { return d_format != FORMAT_NONE; }
+
+  // Link type of the first interface (classic pcap has only one)
+  int linktype() const;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_PCAP_FILE_READER_H */
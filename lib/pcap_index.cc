@@ -0,0 +1,371 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcap_index.h"
+#include "pcap_udp_parser.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace gr {
+namespace grnet {
+
+// On-disk layout.  All fields are naturally aligned so there's no
+// compiler padding.
+struct index_file_header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t interval_ns;
+  uint64_t capture_size;
+  uint64_t capture_mtime_ns;
+  uint64_t port_count;
+  uint64_t entry_count;
+};
+
+struct index_file_port {
+  uint16_t port;
+  uint16_t reserved[3];
+  uint64_t packets;
+  uint64_t first_ts;
+  uint64_t last_ts;
+};
+
+struct index_file_entry {
+  uint16_t port;
+  uint16_t reserved[3];
+  uint64_t ts_ns;
+  uint64_t offset;
+  uint64_t section;
+};
+
+pcap_index::pcap_index()
+    : d_interval_ns(PCAPINDEX_DEFAULT_INTERVAL_NS), d_capture_size(0),
+      d_capture_mtime_ns(0) {}
+
+bool pcap_index::capture_stat(const std::string &capture, uint64_t &size,
+                              uint64_t &mtime_ns, std::string &err) {
+  struct stat st;
+
+  if (stat(capture.c_str(), &st) != 0) {
+    err = capture + ": " + strerror(errno);
+    return false;
+  }
+
+  size = st.st_size;
+  mtime_ns = (uint64_t)st.st_mtim.tv_sec * 1000000000ULL + st.st_mtim.tv_nsec;
+
+  return true;
+}
+
+bool pcap_index::build(const std::string &capture, std::string &err,
+                       uint64_t interval_ns) {
+  d_ports.clear();
+  d_entries.clear();
+  d_interval_ns = interval_ns;
+
+  if (!capture_stat(capture, d_capture_size, d_capture_mtime_ns, err))
+    return false;
+
+  pcap_file_reader reader;
+
+  if (!reader.open(capture, err))
+    return false;
+
+  if (!reader.is_mapped()) {
+    err = "can only index uncompressed pcap/pcapng files";
+    return false;
+  }
+
+  pcap_udp_parser parser;
+  pcap_udp_parser::udp_info udp;
+  pcap_udp_parser::ip_fragment frag;
+  pcap_file_reader::packet pkt;
+
+  // Per-port slot in d_ports while building, and when that port last got
+  // an entry.
+  std::vector<int32_t> slot(65536, -1);
+  std::vector<uint64_t> lastEntry;
+
+  pcap_file_reader::position pos = reader.tell();
+
+  while (reader.next(pkt)) {
+    uint16_t port;
+    bool found = false;
+
+    if (pkt.len == pkt.caplen) {
+      switch (parser.parse(pkt, udp, frag)) {
+      case pcap_udp_parser::PARSE_UDP:
+        port = udp.destPort;
+        found = true;
+        break;
+
+      case pcap_udp_parser::PARSE_FRAGMENT:
+        // A datagram starts at its first fragment, which carries the UDP
+        // header.
+        if (frag.offset == 0 && frag.len >= 8) {
+          port = ((uint16_t)frag.data[2] << 8) | frag.data[3];
+          found = true;
+        }
+        break;
+
+      default:
+        break;
+      }
+    }
+
+    if (found) {
+      if (slot[port] < 0) {
+        port_info info;
+        info.port = port;
+        info.packets = 0;
+        info.first_ts = pkt.ts_ns;
+        info.last_ts = pkt.ts_ns;
+
+        slot[port] = d_ports.size();
+        d_ports.push_back(info);
+        lastEntry.push_back(0);
+      }
+
+      port_info &info = d_ports[slot[port]];
+      bool first = (info.packets == 0);
+
+      info.packets++;
+      info.last_ts = std::max(info.last_ts, pkt.ts_ns);
+
+      if (first || pkt.ts_ns >= lastEntry[slot[port]] + d_interval_ns) {
+        entry e;
+        e.port = port;
+        e.ts_ns = pkt.ts_ns;
+        e.pos = pos;
+        d_entries.push_back(e);
+
+        lastEntry[slot[port]] = pkt.ts_ns;
+      }
+    }
+
+    pos = reader.tell();
+  }
+
+  std::sort(d_ports.begin(), d_ports.end(),
+            [](const port_info &a, const port_info &b) {
+              return a.port < b.port;
+            });
+
+  // Stable, so each port's entries stay in capture order.
+  std::stable_sort(d_entries.begin(), d_entries.end(),
+                   [](const entry &a, const entry &b) {
+                     return a.port < b.port;
+                   });
+
+  return true;
+}
+
+bool pcap_index::save(const std::string &sidecar, std::string &err) const {
+  // Write to a temporary file and rename it into place, so a reader never
+  // sees a partial index.
+  std::string tmpName = sidecar + ".tmp";
+  FILE *fp = fopen(tmpName.c_str(), "wb");
+
+  if (fp == NULL) {
+    err = tmpName + ": " + strerror(errno);
+    return false;
+  }
+
+  index_file_header header;
+  memset(&header, 0, sizeof(header));
+  header.magic = PCAPINDEX_MAGIC;
+  header.version = PCAPINDEX_VERSION;
+  header.interval_ns = d_interval_ns;
+  header.capture_size = d_capture_size;
+  header.capture_mtime_ns = d_capture_mtime_ns;
+  header.port_count = d_ports.size();
+  header.entry_count = d_entries.size();
+
+  bool ok = (fwrite(&header, sizeof(header), 1, fp) == 1);
+
+  for (size_t i = 0; ok && i < d_ports.size(); i++) {
+    index_file_port rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.port = d_ports[i].port;
+    rec.packets = d_ports[i].packets;
+    rec.first_ts = d_ports[i].first_ts;
+    rec.last_ts = d_ports[i].last_ts;
+
+    ok = (fwrite(&rec, sizeof(rec), 1, fp) == 1);
+  }
+
+  for (size_t i = 0; ok && i < d_entries.size(); i++) {
+    index_file_entry rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.port = d_entries[i].port;
+    rec.ts_ns = d_entries[i].ts_ns;
+    rec.offset = d_entries[i].pos.offset;
+    rec.section = d_entries[i].pos.section;
+
+    ok = (fwrite(&rec, sizeof(rec), 1, fp) == 1);
+  }
+
+  if (fclose(fp) != 0)
+    ok = false;
+
+  if (ok && rename(tmpName.c_str(), sidecar.c_str()) != 0)
+    ok = false;
+
+  if (!ok) {
+    err = sidecar + ": " + strerror(errno);
+    unlink(tmpName.c_str());
+  }
+
+  return ok;
+}
+
+bool pcap_index::load(const std::string &sidecar, const std::string &capture,
+                      std::string &err) {
+  d_ports.clear();
+  d_entries.clear();
+
+  uint64_t captureSize, captureMtime;
+
+  if (!capture_stat(capture, captureSize, captureMtime, err))
+    return false;
+
+  FILE *fp = fopen(sidecar.c_str(), "rb");
+
+  if (fp == NULL) {
+    err = sidecar + ": " + strerror(errno);
+    return false;
+  }
+
+  index_file_header header;
+  bool ok = (fread(&header, sizeof(header), 1, fp) == 1);
+
+  if (!ok || header.magic != PCAPINDEX_MAGIC ||
+      header.version != PCAPINDEX_VERSION) {
+    fclose(fp);
+    err = sidecar + ": not a packet index";
+    return false;
+  }
+
+  if (header.capture_size != captureSize ||
+      header.capture_mtime_ns != captureMtime) {
+    fclose(fp);
+    err = sidecar + ": out of date (capture has changed)";
+    return false;
+  }
+
+  // Sanity check the counts against the file size before allocating.
+  struct stat st;
+
+  if (fstat(fileno(fp), &st) != 0 ||
+      (uint64_t)st.st_size != sizeof(header) +
+                                  header.port_count * sizeof(index_file_port) +
+                                  header.entry_count *
+                                      sizeof(index_file_entry)) {
+    fclose(fp);
+    err = sidecar + ": truncated or corrupt";
+    return false;
+  }
+
+  d_interval_ns = header.interval_ns;
+  d_capture_size = header.capture_size;
+  d_capture_mtime_ns = header.capture_mtime_ns;
+
+  d_ports.resize(header.port_count);
+  d_entries.resize(header.entry_count);
+
+  for (size_t i = 0; ok && i < d_ports.size(); i++) {
+    index_file_port rec;
+    ok = (fread(&rec, sizeof(rec), 1, fp) == 1);
+
+    d_ports[i].port = rec.port;
+    d_ports[i].packets = rec.packets;
+    d_ports[i].first_ts = rec.first_ts;
+    d_ports[i].last_ts = rec.last_ts;
+  }
+
+  for (size_t i = 0; ok && i < d_entries.size(); i++) {
+    index_file_entry rec;
+    ok = (fread(&rec, sizeof(rec), 1, fp) == 1);
+
+    d_entries[i].port = rec.port;
+    d_entries[i].ts_ns = rec.ts_ns;
+    d_entries[i].pos.offset = rec.offset;
+    d_entries[i].pos.section = rec.section;
+  }
+
+  fclose(fp);
+
+  if (!ok) {
+    d_ports.clear();
+    d_entries.clear();
+    err = sidecar + ": read error";
+  }
+
+  return ok;
+}
+
+const pcap_index::port_info *pcap_index::find_port(uint16_t port) const {
+  std::vector<port_info>::const_iterator it = std::lower_bound(
+      d_ports.begin(), d_ports.end(), port,
+      [](const port_info &a, uint16_t p) { return a.port < p; });
+
+  if (it == d_ports.end() || it->port != port)
+    return NULL;
+
+  return &(*it);
+}
+
+bool pcap_index::find(uint16_t port, uint64_t ts_ns,
+                      pcap_file_reader::position &pos) const {
+  std::vector<entry>::const_iterator first = std::lower_bound(
+      d_entries.begin(), d_entries.end(), port,
+      [](const entry &a, uint16_t p) { return a.port < p; });
+
+  if (first == d_entries.end() || first->port != port)
+    return false;
+
+  std::vector<entry>::const_iterator last = std::upper_bound(
+      first, d_entries.end(), port,
+      [](uint16_t p, const entry &a) { return p < a.port; });
+
+  // Last entry at or before ts_ns
+  std::vector<entry>::const_iterator it = std::upper_bound(
+      first, last, ts_ns,
+      [](uint64_t ts, const entry &a) { return ts < a.ts_ns; });
+
+  if (it != first)
+    --it;
+
+  pos = it->pos;
+
+  return true;
+}
+
+} // namespace grnet
+} // namespace gr
@@ -0,0 +1,110 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_PCAP_INDEX_H
+#define INCLUDED_GRNET_PCAP_INDEX_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "pcap_file_reader.h"
+
+#define PCAPINDEX_MAGIC 0x494E5247 // "GRNI" on disk (little-endian)
+#define PCAPINDEX_VERSION 1
+#define PCAPINDEX_SUFFIX ".grnetidx"
+
+// Spacing between index entries for each port, in capture time
+#define PCAPINDEX_DEFAULT_INTERVAL_NS 100000000ULL // 100 ms
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Seek index for a capture file, kept in a sidecar next to it
+ * (<capture>.grnetidx).
+ *
+ * For every UDP destination port in the capture it records the first and
+ * last capture time and packet count, plus the file position of a packet
+ * at least every interval of capture time.  To start playback part way
+ * into a capture, look up the last entry at or before the start time,
+ * seek there and read forward: at most one interval's worth of packets is
+ * read and thrown away instead of everything before the start.
+ *
+ * The sidecar is in host byte order.  It records the size and
+ * modification time of the capture it was built from, and load() refuses
+ * a sidecar that no longer matches.
+ */
+class pcap_index {
+public:
+  struct port_info {
+    uint16_t port;
+    uint64_t packets;
+    uint64_t first_ts;
+    uint64_t last_ts;
+  };
+
+private:
+  struct entry {
+    uint16_t port;
+    uint64_t ts_ns;
+    pcap_file_reader::position pos;
+  };
+
+  std::vector<port_info> d_ports; // Sorted by port
+  std::vector<entry> d_entries;   // Sorted by port, then capture order
+  uint64_t d_interval_ns;
+  uint64_t d_capture_size;
+  uint64_t d_capture_mtime_ns;
+
+  static bool capture_stat(const std::string &capture, uint64_t &size,
+                           uint64_t &mtime_ns, std::string &err);
+
+public:
+  pcap_index();
+
+  static std::string sidecar_name(const std::string &capture) {
+    return capture + PCAPINDEX_SUFFIX;
+  }
+
+  // Scan a capture and build the index in memory.  Fragmented datagrams
+  // are indexed at their first fragment, where the UDP header is.
+  bool build(const std::string &capture, std::string &err,
+             uint64_t interval_ns = PCAPINDEX_DEFAULT_INTERVAL_NS);
+
+  bool save(const std::string &sidecar, std::string &err) const;
+
+  // Load a sidecar, rejecting it if it doesn't match capture.
+  bool load(const std::string &sidecar, const std::string &capture,
+            std::string &err);
+
+  const std::vector<port_info> &ports() const { return d_ports; }
+  const port_info *find_port(uint16_t port) const;
+
+  // Position to start reading from to get every packet for port captured
+  // at or after ts_ns.  False if the port isn't in the capture.
+  bool find(uint16_t port, uint64_t ts_ns,
+            pcap_file_reader::position &pos) const;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_PCAP_INDEX_H */
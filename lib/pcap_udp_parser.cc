@@ -0,0 +1,260 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pcap_udp_parser.h"
+
+#include <arpa/inet.h>
+#include <string.h>
+
+#define ETHERTYPE_IPV4_VAL 0x0800
+#define ETHERTYPE_IPV6_VAL 0x86DD
+#define ETHERTYPE_8021Q_VAL 0x8100
+#define ETHERTYPE_8021AD_VAL 0x88A8
+#define ETHERTYPE_QINQ_OLD_VAL 0x9100
+
+#define IPPROTO_UDP_VAL 17
+#define IPV6_EXT_HOPOPTS 0
+#define IPV6_EXT_ROUTING 43
+#define IPV6_EXT_FRAGMENT 44
+#define IPV6_EXT_DSTOPTS 60
+
+namespace gr {
+namespace grnet {
+
+static inline uint16_t rd16be(const uint8_t *p) {
+  uint16_t v;
+  memcpy(&v, p, sizeof(v));
+  return ntohs(v);
+}
+
+pcap_udp_parser::pcap_udp_parser()
+    : d_linktype(-1), d_supported(false), d_link_header_len(0),
+      d_ethertype_offset(-1), d_vlan_possible(false) {}
+
+void pcap_udp_parser::set_linktype(int linktype) {
+  d_linktype = linktype;
+  d_supported = true;
+  d_vlan_possible = false;
+  d_ethertype_offset = -1;
+
+  switch (linktype) {
+  case PCAP_LINKTYPE_ETHERNET:
+    d_link_header_len = 14;
+    d_ethertype_offset = 12;
+    d_vlan_possible = true;
+    break;
+
+  case PCAP_LINKTYPE_LINUX_SLL:
+    // pkttype, hatype, halen, addr[8], protocol
+    d_link_header_len = 16;
+    d_ethertype_offset = 14;
+    break;
+
+  case PCAP_LINKTYPE_LINUX_SLL2:
+    // protocol first, then reserved, ifindex, hatype, pkttype, halen, addr
+    d_link_header_len = 20;
+    d_ethertype_offset = 0;
+    break;
+
+  case PCAP_LINKTYPE_NULL:
+    // 4-byte address family in the capturing host's byte order
+    d_link_header_len = 4;
+    break;
+
+  case PCAP_DLT_RAW:
+  case PCAP_LINKTYPE_RAW:
+  case PCAP_LINKTYPE_IPV4:
+  case PCAP_LINKTYPE_IPV6:
+    d_link_header_len = 0;
+    break;
+
+  default:
+    d_supported = false;
+    break;
+  }
+}
+
+pcap_udp_parser::parse_result
+pcap_udp_parser::parse(const pcap_file_reader::packet &pkt, udp_info &info,
+                       ip_fragment &frag) {
+  if (pkt.linktype != d_linktype)
+    set_linktype(pkt.linktype);
+
+  if (!d_supported || pkt.caplen < (uint32_t)d_link_header_len)
+    return PARSE_SKIP;
+
+  const uint8_t *p = pkt.data;
+  size_t offset = d_link_header_len;
+  int version;
+
+  if (d_ethertype_offset >= 0) {
+    uint16_t ethertype = rd16be(&p[d_ethertype_offset]);
+
+    if (d_vlan_possible) {
+      // Up to two tags (QinQ).  Each tag's ethertype sits in its last 2
+      // bytes.
+      for (int tags = 0;
+           tags < 2 && (ethertype == ETHERTYPE_8021Q_VAL ||
+                        ethertype == ETHERTYPE_8021AD_VAL ||
+                        ethertype == ETHERTYPE_QINQ_OLD_VAL);
+           tags++) {
+        if (offset + 4 > pkt.caplen)
+          return PARSE_SKIP;
+
+        ethertype = rd16be(&p[offset + 2]);
+        offset += 4;
+      }
+    }
+
+    if (ethertype == ETHERTYPE_IPV4_VAL)
+      version = 4;
+    else if (ethertype == ETHERTYPE_IPV6_VAL)
+      version = 6;
+    else
+      return PARSE_SKIP;
+  } else {
+    if (offset >= pkt.caplen)
+      return PARSE_SKIP;
+
+    version = p[offset] >> 4;
+  }
+
+  if (version == 4)
+    return parse_ipv4(&p[offset], pkt.caplen - offset, info, frag);
+  else if (version == 6)
+    return parse_ipv6(&p[offset], pkt.caplen - offset, info);
+
+  return PARSE_SKIP;
+}
+
+pcap_udp_parser::parse_result
+pcap_udp_parser::parse_ipv4(const uint8_t *ip, size_t avail, udp_info &info,
+                            ip_fragment &frag) const {
+  if (avail < 20 || (ip[0] >> 4) != 4)
+    return PARSE_SKIP;
+
+  // IP Header length is defined in a packet field (IHL).  IHL represents
+  // the # of 32-bit words So header size is ihl * 4 [bytes]
+  size_t ihl = (ip[0] & 0x0F) * 4;
+
+  if (ihl < 20 || ip[9] != IPPROTO_UDP_VAL)
+    return PARSE_SKIP;
+
+  size_t totalLen = rd16be(&ip[2]);
+
+  if (totalLen < ihl || totalLen > avail)
+    return PARSE_SKIP;
+
+  uint16_t flagsOffset = rd16be(&ip[6]);
+
+  // MF set or non-zero offset: hand it back for reassembly.
+  if (flagsOffset & 0x3FFF) {
+    memcpy(&frag.src, &ip[12], sizeof(frag.src));
+    memcpy(&frag.dst, &ip[16], sizeof(frag.dst));
+    frag.id = rd16be(&ip[4]);
+    frag.proto = ip[9];
+    frag.more = (flagsOffset & 0x2000) != 0;
+    frag.offset = (uint32_t)(flagsOffset & 0x1FFF) * 8;
+    frag.data = &ip[ihl];
+    frag.len = totalLen - ihl;
+
+    return PARSE_FRAGMENT;
+  }
+
+  info.ipVersion = 4;
+
+  return parse_udp(&ip[ihl], totalLen - ihl, info) ? PARSE_UDP : PARSE_SKIP;
+}
+
+pcap_udp_parser::parse_result
+pcap_udp_parser::parse_ipv6(const uint8_t *ip, size_t avail,
+                            udp_info &info) const {
+  if (avail < 40)
+    return PARSE_SKIP;
+
+  size_t payloadLen = rd16be(&ip[4]);
+
+  if (40 + payloadLen > avail)
+    return PARSE_SKIP;
+
+  uint8_t next = ip[6];
+  size_t offset = 40;
+  size_t end = 40 + payloadLen;
+
+  // Skip extension headers until we get to UDP.
+  while (next != IPPROTO_UDP_VAL) {
+    if (offset + 8 > end)
+      return PARSE_SKIP;
+
+    switch (next) {
+    case IPV6_EXT_HOPOPTS:
+    case IPV6_EXT_ROUTING:
+    case IPV6_EXT_DSTOPTS:
+      next = ip[offset];
+      offset += (ip[offset + 1] + 1) * 8;
+      break;
+
+    case IPV6_EXT_FRAGMENT:
+      // Only atomic fragments (offset 0, no more fragments) are whole.
+      if (rd16be(&ip[offset + 2]) & 0xFFF9)
+        return PARSE_SKIP;
+
+      next = ip[offset];
+      offset += 8;
+      break;
+
+    default:
+      return PARSE_SKIP;
+    }
+  }
+
+  if (offset > end)
+    return PARSE_SKIP;
+
+  info.ipVersion = 6;
+
+  return parse_udp(&ip[offset], end - offset, info) ? PARSE_UDP : PARSE_SKIP;
+}
+
+bool pcap_udp_parser::parse_udp(const uint8_t *udp, size_t avail,
+                                udp_info &info) const {
+  if (avail < 8)
+    return false;
+
+  size_t udpLen = rd16be(&udp[4]);
+
+  // Ignore anything claiming more data than was captured
+  if (udpLen < 8 || udpLen > avail)
+    return false;
+
+  info.srcPort = rd16be(&udp[0]);
+  info.destPort = rd16be(&udp[2]);
+  info.payload = &udp[8];
+  info.len = udpLen - 8;
+
+  return true;
+}
+
+} // namespace grnet
+} // namespace gr
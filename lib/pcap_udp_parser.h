@@ -0,0 +1,111 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_PCAP_UDP_PARSER_H
+#define INCLUDED_GRNET_PCAP_UDP_PARSER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pcap_file_reader.h"
+
+// Link types we can find IP in (pcap LINKTYPE_* values, plus the DLT_RAW
+// value libpcap reports on Linux)
+#define PCAP_LINKTYPE_NULL 0
+#define PCAP_LINKTYPE_ETHERNET 1
+#define PCAP_DLT_RAW 12
+#define PCAP_LINKTYPE_RAW 101
+#define PCAP_LINKTYPE_LINUX_SLL 113
+#define PCAP_LINKTYPE_IPV4 228
+#define PCAP_LINKTYPE_IPV6 229
+#define PCAP_LINKTYPE_LINUX_SLL2 276
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Finds the UDP datagram in a captured frame.
+ *
+ * Handles Ethernet (with up to two 802.1Q/802.1ad tags), Linux cooked
+ * captures (SLL and SLL2, as written by tcpdump -i any), BSD loopback and
+ * raw IP link types, carrying IPv4 or IPv6.  The link-layer layout is
+ * worked out once per link type rather than per packet; a file normally
+ * only has one, so the per-packet path is a fixed offset plus a
+ * protocol-field read.
+ */
+class pcap_udp_parser {
+public:
+  struct udp_info {
+    const uint8_t *payload;
+    uint32_t len; // UDP payload bytes
+    uint16_t srcPort;
+    uint16_t destPort;
+    int ipVersion;
+  };
+
+  // An IPv4 fragment of a UDP datagram.  Only the first fragment carries
+  // the UDP header, so these have to be reassembled before the port is
+  // known.
+  struct ip_fragment {
+    uint32_t src;
+    uint32_t dst;
+    uint16_t id;
+    uint8_t proto;
+    bool more; // MF flag
+    uint32_t offset; // bytes into the IP payload
+    const uint8_t *data;
+    uint32_t len;
+  };
+
+  enum parse_result { PARSE_SKIP = 0, PARSE_UDP, PARSE_FRAGMENT };
+
+private:
+  // Precomputed link-layer layout for d_linktype
+  int d_linktype;
+  bool d_supported;
+  int d_link_header_len;
+  int d_ethertype_offset; // -1: no ethertype, go by the IP version nibble
+  bool d_vlan_possible;
+
+  void set_linktype(int linktype);
+
+  parse_result parse_ipv4(const uint8_t *ip, size_t avail, udp_info &info,
+                          ip_fragment &frag) const;
+  parse_result parse_ipv6(const uint8_t *ip, size_t avail,
+                          udp_info &info) const;
+
+public:
+  pcap_udp_parser();
+
+  // PARSE_UDP if pkt carries an unfragmented UDP datagram whose payload
+  // was fully captured (info is filled in), PARSE_FRAGMENT for a fully
+  // captured IPv4 fragment of a UDP datagram (frag is filled in), and
+  // PARSE_SKIP for anything else.
+  parse_result parse(const pcap_file_reader::packet &pkt, udp_info &info,
+                     ip_fragment &frag);
+
+  // Decode a UDP header + payload, e.g. a reassembled datagram.
+  bool parse_udp(const uint8_t *udp, size_t avail, udp_info &info) const;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_PCAP_UDP_PARSER_H */
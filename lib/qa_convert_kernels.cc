@@ -0,0 +1,126 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "convert_kernels.h"
+
+#include <boost/test/unit_test.hpp>
+#include <cstring>
+#include <vector>
+
+namespace gr {
+namespace grnet {
+
+// Float bit patterns for the to-16-bit tests: a stride through all of
+// them, plus the edges the rounding and special cases turn on.
+static std::vector<float> test_floats() {
+  static const uint32_t edges[] = {
+      0x00000000, 0x00000001, 0x007fffff, 0x00800000, // Zero, denormals
+      0x33000000, 0x33000001, 0x387fe000, 0x38800000, // FP16 subnormals
+      0x3f808000, 0x3f818000, 0x3f807fff, 0x3f808001, // bfloat16 ties
+      0x3f801000, 0x3f803000, 0x3f800fff, 0x3f801001, // FP16 ties
+      0x477fe000, 0x477fefff, 0x477ff000, 0x7f7fffff, // FP16 overflow
+      0x7f800000, 0x7f800001, 0x7fa00000, 0x7fbfffff, // inf, signalling NaN
+      0x7fc00000, 0x7fffffff, 0x7fc00001, 0x7f802000, // quiet NaN
+  };
+  std::vector<float> v;
+
+  for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+    for (int negative = 0; negative < 2; negative++) {
+      uint32_t x = edges[i] | (negative ? 0x80000000u : 0);
+      float f;
+      memcpy(&f, &x, sizeof(f));
+      v.push_back(f);
+    }
+  }
+
+  for (uint64_t x = 0; x <= 0xffffffffull; x += 4099) {
+    uint32_t bits = (uint32_t)x;
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    v.push_back(f);
+  }
+
+  // Not a multiple of any vector width, so the tails get used too
+  while (v.size() % 32 != 13)
+    v.push_back(1.0f);
+
+  return v;
+}
+
+static void check_to_16f(bool bfloat16) {
+  std::vector<float> in = test_floats();
+  std::vector<uint16_t> simd(in.size()), ref(in.size());
+
+  convert_32f_to_16f(&simd[0], &in[0], bfloat16, in.size());
+  convert_32f_to_16f_reference(&ref[0], &in[0], bfloat16, in.size());
+
+  size_t mismatches = 0;
+  for (size_t i = 0; i < in.size(); i++) {
+    if (simd[i] != ref[i]) {
+      if (mismatches++ < 10) {
+        uint32_t x;
+        memcpy(&x, &in[i], sizeof(x));
+        BOOST_TEST_MESSAGE(std::hex << "0x" << x << ": 0x" << simd[i]
+                                    << " vs 0x" << ref[i]);
+      }
+    }
+  }
+
+  BOOST_CHECK_EQUAL(mismatches, 0u);
+}
+
+static void check_from_16f(bool bfloat16) {
+  // Every 16-bit value, and a few more for a ragged tail
+  std::vector<uint16_t> in(65536 + 13);
+  for (size_t i = 0; i < in.size(); i++)
+    in[i] = (uint16_t)i;
+
+  std::vector<float> simd(in.size()), ref(in.size());
+
+  convert_16f_to_32f(&simd[0], &in[0], bfloat16, in.size());
+  convert_16f_to_32f_reference(&ref[0], &in[0], bfloat16, in.size());
+
+  // Compared as bits, so NaNs count
+  size_t mismatches = 0;
+  for (size_t i = 0; i < in.size(); i++) {
+    if (memcmp(&simd[i], &ref[i], sizeof(float)) != 0) {
+      if (mismatches++ < 10) {
+        uint32_t a, b;
+        memcpy(&a, &simd[i], sizeof(a));
+        memcpy(&b, &ref[i], sizeof(b));
+        BOOST_TEST_MESSAGE(std::hex << "0x" << in[i] << ": 0x" << a
+                                    << " vs 0x" << b);
+      }
+    }
+  }
+
+  BOOST_CHECK_EQUAL(mismatches, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(t_32f_to_fp16) { check_to_16f(false); }
+
+BOOST_AUTO_TEST_CASE(t_32f_to_bf16) { check_to_16f(true); }
+
+BOOST_AUTO_TEST_CASE(t_fp16_to_32f) { check_from_16f(false); }
+
+BOOST_AUTO_TEST_CASE(t_bf16_to_32f) { check_from_16f(true); }
+
+} /* namespace grnet */
+} /* namespace gr */
@@ -0,0 +1,151 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packet_ring.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstring>
+
+namespace gr {
+namespace grnet {
+
+static void push(packet_ring &ring, size_t len, char fill) {
+  char *p = ring.reserve(len);
+  BOOST_REQUIRE(p != NULL);
+  memset(p, fill, len);
+  ring.commit(len);
+}
+
+static void pop_check(packet_ring &ring, size_t len, char fill) {
+  const packet_ring::descriptor *d = ring.front();
+  BOOST_REQUIRE(d != NULL);
+  BOOST_CHECK_EQUAL(d->len, len);
+
+  const char *p = ring.data(d);
+  for (size_t i = 0; i < len; i++) {
+    if (p[i] != fill) {
+      BOOST_ERROR("packet data overwritten at byte " << i);
+      break;
+    }
+  }
+
+  ring.pop();
+}
+
+BOOST_AUTO_TEST_CASE(t_wrap) {
+  packet_ring ring(1000, 16);
+
+  push(ring, 400, 'A');
+  push(ring, 400, 'B');
+  pop_check(ring, 400, 'A');
+
+  // 200 left at the end isn't enough, but [0, 400) is free again
+  push(ring, 300, 'C');
+  pop_check(ring, 400, 'B');
+  pop_check(ring, 300, 'C');
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_CASE(t_full) {
+  packet_ring ring(1000, 16);
+
+  push(ring, 600, 'A');
+  BOOST_CHECK(ring.reserve(500) == NULL);
+
+  push(ring, 300, 'B');
+  BOOST_CHECK(ring.reserve(200) == NULL); // Only 100 at the end
+
+  pop_check(ring, 600, 'A');
+  pop_check(ring, 300, 'B');
+}
+
+BOOST_AUTO_TEST_CASE(t_drain_then_refill) {
+  packet_ring ring(1000, 16);
+
+  // Drain, so the next packet restarts at offset 0 while the consumer's
+  // last read offset was 300.
+  push(ring, 300, 'A');
+  pop_check(ring, 300, 'A');
+
+  push(ring, 400, 'B');
+  push(ring, 400, 'C');
+
+  // [800, 1000) is too small and [0, 800) is still queued
+  BOOST_CHECK(ring.reserve(250) == NULL);
+
+  pop_check(ring, 400, 'B');
+  push(ring, 250, 'D'); // Wraps into the space B left
+  pop_check(ring, 400, 'C');
+  pop_check(ring, 250, 'D');
+  BOOST_CHECK(ring.empty());
+}
+
+BOOST_AUTO_TEST_CASE(t_descriptors) {
+  packet_ring ring(1000, 4);
+
+  for (int i = 0; i < 4; i++)
+    push(ring, 10, 'a' + i);
+
+  BOOST_CHECK(ring.reserve(10) == NULL);
+  BOOST_CHECK_EQUAL(ring.packets_queued(), 4u);
+  BOOST_CHECK_EQUAL(ring.bytes_queued(), 40u);
+
+  for (int i = 0; i < 4; i++)
+    pop_check(ring, 10, 'a' + i);
+}
+
+BOOST_AUTO_TEST_CASE(t_threaded) {
+  // Sizes chosen so packets wrap at varying points and the ring keeps
+  // draining and refilling.
+  const int npackets = 200000;
+  packet_ring ring(4096, 64);
+
+  boost::thread producer([&ring]() {
+    for (int i = 0; i < npackets; i++) {
+      size_t len = 1 + (i * 7919) % 1500;
+      char *p;
+      while ((p = ring.reserve(len)) == NULL)
+        boost::this_thread::yield();
+      memset(p, (char)i, len);
+      ring.commit(len);
+    }
+  });
+
+  int bad = 0;
+  for (int i = 0; i < npackets; i++) {
+    const packet_ring::descriptor *d;
+    while ((d = ring.front()) == NULL)
+      boost::this_thread::yield();
+
+    size_t len = 1 + (i * 7919) % 1500;
+    const char *p = ring.data(d);
+    if (d->len != len || p[0] != (char)i || p[len - 1] != (char)i)
+      bad++;
+    ring.pop();
+  }
+
+  producer.join();
+  BOOST_CHECK_EQUAL(bad, 0);
+  BOOST_CHECK(ring.empty());
+}
+
+} /* namespace grnet */
+} /* namespace gr */
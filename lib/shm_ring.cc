@@ -0,0 +1,491 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_ring.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <new>
+#include <stdexcept>
+
+static_assert(sizeof(gr::grnet::shm_ring_header) <= SHM_RING_DATA_OFFSET,
+              "shm ring header must fit in the header page");
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+              "shm ring needs lock-free 64-bit atomics to work across "
+              "processes");
+
+namespace gr {
+namespace grnet {
+
+// Shared (not FUTEX_PRIVATE) since the words live in memory mapped by
+// different processes.
+static void futex_wait(std::atomic<uint32_t> *addr, uint32_t expected,
+                       int timeout_ms) {
+  struct timespec ts;
+  ts.tv_sec = timeout_ms / 1000;
+  ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+
+  syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAIT, expected, &ts, NULL, 0);
+}
+
+static void futex_wake(std::atomic<uint32_t> *addr) {
+  syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+}
+
+shm_ring::shm_ring()
+    : d_fd(-1), d_map(NULL), d_map_size(0), d_header(NULL), d_data(NULL),
+      d_slot(-1), d_writer(false) {}
+
+shm_ring::~shm_ring() { close(); }
+
+std::string shm_ring::normalize_name(const std::string &name) {
+  if (!name.empty() && name[0] == '/')
+    return name;
+
+  return std::string("/") + name;
+}
+
+void shm_ring::unmap() {
+  if (d_map) {
+    munmap(d_map, d_map_size);
+    d_map = NULL;
+  }
+
+  if (d_fd >= 0) {
+    ::close(d_fd);
+    d_fd = -1;
+  }
+
+  d_header = NULL;
+  d_data = NULL;
+  d_map_size = 0;
+}
+
+void shm_ring::create(const std::string &name, size_t itemsize,
+                      size_t capacity) {
+  d_name = normalize_name(name);
+  d_writer = true;
+
+  // Whole items only, so an item never has to be stitched back together
+  // from two partial ones.
+  capacity -= capacity % itemsize;
+
+  if (capacity == 0)
+    throw std::runtime_error("[Shared Memory Sink] Ring size must be at "
+                             "least one item.");
+
+  d_fd = shm_open(d_name.c_str(), O_CREAT | O_RDWR, 0660);
+
+  if (d_fd < 0)
+    throw std::runtime_error(
+        std::string("[Shared Memory Sink] Unable to open ") + d_name + ": " +
+        strerror(errno));
+
+  d_map_size = SHM_RING_DATA_OFFSET + capacity;
+
+  struct stat st;
+  bool reuse = false;
+
+  if (fstat(d_fd, &st) == 0 && (size_t)st.st_size == d_map_size)
+    reuse = true;
+  else if (ftruncate(d_fd, d_map_size) != 0) {
+    std::string err = strerror(errno);
+    unmap();
+    throw std::runtime_error(
+        std::string("[Shared Memory Sink] Unable to size ") + d_name + ": " +
+        err);
+  }
+
+  d_map = (char *)mmap(NULL, d_map_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       d_fd, 0);
+
+  if (d_map == MAP_FAILED) {
+    d_map = NULL;
+    std::string err = strerror(errno);
+    unmap();
+    throw std::runtime_error(
+        std::string("[Shared Memory Sink] Unable to map ") + d_name + ": " +
+        err);
+  }
+
+  d_header = (shm_ring_header *)d_map;
+  d_data = d_map + SHM_RING_DATA_OFFSET;
+
+  // A segment left behind by a previous writer with the same geometry is
+  // picked up where it left off, so readers that are still attached just
+  // see the stream continue.
+  if (reuse && d_header->magic == SHM_RING_MAGIC &&
+      d_header->version == SHM_RING_VERSION &&
+      d_header->itemsize == itemsize && d_header->capacity == capacity) {
+    d_header->generation.fetch_add(1);
+  } else {
+    d_header->magic = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    new (d_header) shm_ring_header();
+    d_header->version = SHM_RING_VERSION;
+    d_header->itemsize = itemsize;
+    d_header->capacity = capacity;
+    d_header->writeIndex.store(0);
+    d_header->writeReserve.store(0);
+    d_header->writeSeq.store(0);
+    d_header->readersWaiting.store(0);
+    d_header->generation.store(0);
+    d_header->readSeq.store(0);
+    d_header->writerWaiting.store(0);
+
+    for (int i = 0; i < SHM_RING_MAX_READERS; i++) {
+      d_header->readers[i].state.store(SHM_SLOT_FREE);
+      d_header->readers[i].pid.store(0);
+      d_header->readers[i].readIndex.store(0);
+    }
+
+    // Readers check the magic last, so publish it last.
+    std::atomic_thread_fence(std::memory_order_release);
+    d_header->magic = SHM_RING_MAGIC;
+  }
+
+  d_header->writerAlive.store(1);
+}
+
+uint64_t shm_ring::slowest_reader(uint64_t writeIndex) {
+  uint64_t slowest = writeIndex;
+
+  for (int i = 0; i < SHM_RING_MAX_READERS; i++) {
+    shm_ring_reader_slot &slot = d_header->readers[i];
+
+    if (slot.state.load(std::memory_order_acquire) != SHM_SLOT_ACTIVE)
+      continue;
+
+    uint64_t r = slot.readIndex.load(std::memory_order_acquire);
+
+    if (writeIndex - r > writeIndex - slowest)
+      slowest = r;
+  }
+
+  return slowest;
+}
+
+void shm_ring::reclaim_dead_readers() {
+  // A reader that crashed never releases its slot and would hold a
+  // lossless writer up forever.
+  for (int i = 0; i < SHM_RING_MAX_READERS; i++) {
+    shm_ring_reader_slot &slot = d_header->readers[i];
+
+    if (slot.state.load() == SHM_SLOT_FREE)
+      continue;
+
+    pid_t pid = slot.pid.load();
+
+    if (pid > 0 && kill(pid, 0) != 0 && errno == ESRCH)
+      slot.state.store(SHM_SLOT_FREE);
+  }
+}
+
+size_t shm_ring::write(const char *buffer, size_t bytes, bool lossless,
+                       int timeout_ms) {
+  const uint64_t capacity = d_header->capacity;
+  const uint64_t itemsize = d_header->itemsize;
+
+  // Single writer, so our own index never changes underneath us.
+  uint64_t w = d_header->writeIndex.load(std::memory_order_relaxed);
+  uint64_t space = capacity;
+
+  if (lossless) {
+    space = capacity - (w - slowest_reader(w));
+
+    if (space < itemsize) {
+      uint32_t seq = d_header->readSeq.load();
+      d_header->writerWaiting.store(1);
+
+      // Pairs with the fence in read() and close(): either we see the
+      // reader's progress here, or it sees writerWaiting and wakes us.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      space = capacity - (w - slowest_reader(w));
+
+      if (space < itemsize)
+        futex_wait(&d_header->readSeq, seq, timeout_ms);
+
+      d_header->writerWaiting.store(0);
+
+      space = capacity - (w - slowest_reader(w));
+
+      if (space < itemsize) {
+        reclaim_dead_readers();
+        return 0;
+      }
+    }
+  }
+
+  size_t n = std::min((uint64_t)bytes, space);
+  n -= n % itemsize;
+
+  if (n == 0)
+    return 0;
+
+  d_header->writeReserve.store(w + n, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  size_t pos = w % capacity;
+  size_t first = std::min((uint64_t)n, capacity - pos);
+
+  memcpy(&d_data[pos], buffer, first);
+  if (n > first)
+    memcpy(d_data, &buffer[first], n - first);
+
+  d_header->writeIndex.store(w + n);
+  d_header->writeSeq.fetch_add(1);
+
+  if (d_header->readersWaiting.load() > 0)
+    futex_wake(&d_header->writeSeq);
+
+  return n;
+}
+
+bool shm_ring::open(const std::string &name, size_t itemsize) {
+  d_name = normalize_name(name);
+  d_writer = false;
+
+  d_fd = shm_open(d_name.c_str(), O_RDWR, 0);
+
+  if (d_fd < 0) {
+    if (errno == ENOENT)
+      return false;
+
+    throw std::runtime_error(
+        std::string("[Shared Memory Source] Unable to open ") + d_name +
+        ": " + strerror(errno));
+  }
+
+  struct stat st;
+
+  if (fstat(d_fd, &st) != 0 || (size_t)st.st_size <= SHM_RING_DATA_OFFSET) {
+    // Writer hasn't sized it yet
+    unmap();
+    return false;
+  }
+
+  d_map_size = st.st_size;
+  d_map = (char *)mmap(NULL, d_map_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                       d_fd, 0);
+
+  if (d_map == MAP_FAILED) {
+    d_map = NULL;
+    std::string err = strerror(errno);
+    unmap();
+    throw std::runtime_error(
+        std::string("[Shared Memory Source] Unable to map ") + d_name + ": " +
+        err);
+  }
+
+  d_header = (shm_ring_header *)d_map;
+  d_data = d_map + SHM_RING_DATA_OFFSET;
+
+  if (d_header->magic != SHM_RING_MAGIC) {
+    unmap();
+    return false;
+  }
+
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  if (d_header->version != SHM_RING_VERSION ||
+      d_header->itemsize != itemsize ||
+      SHM_RING_DATA_OFFSET + d_header->capacity != d_map_size) {
+    unmap();
+    throw std::runtime_error(
+        std::string("[Shared Memory Source] ") + d_name +
+        " was created with a different item size or version.");
+  }
+
+  for (int i = 0; i < SHM_RING_MAX_READERS; i++) {
+    uint32_t expected = SHM_SLOT_FREE;
+
+    if (d_header->readers[i].state.compare_exchange_strong(expected,
+                                                           SHM_SLOT_CLAIMED)) {
+      shm_ring_reader_slot &slot = d_header->readers[i];
+
+      // Join at the live edge of the stream.
+      slot.pid.store(getpid());
+      slot.readIndex.store(d_header->writeIndex.load());
+      slot.state.store(SHM_SLOT_ACTIVE);
+
+      d_slot = i;
+      return true;
+    }
+  }
+
+  unmap();
+  throw std::runtime_error(std::string("[Shared Memory Source] ") + d_name +
+                           " already has the maximum number of readers.");
+}
+
+size_t shm_ring::read(char *buffer, size_t maxbytes, int timeout_ms,
+                      uint64_t &missed) {
+  const uint64_t capacity = d_header->capacity;
+  const uint64_t itemsize = d_header->itemsize;
+  shm_ring_reader_slot &slot = d_header->readers[d_slot];
+
+  uint64_t r = slot.readIndex.load(std::memory_order_relaxed);
+  uint64_t w = d_header->writeIndex.load();
+
+  if (w == r) {
+    if (!d_header->writerAlive.load())
+      return 0;
+
+    uint32_t seq = d_header->writeSeq.load();
+    d_header->readersWaiting.fetch_add(1);
+
+    w = d_header->writeIndex.load();
+
+    if (w == r)
+      futex_wait(&d_header->writeSeq, seq, timeout_ms);
+
+    d_header->readersWaiting.fetch_sub(1);
+
+    w = d_header->writeIndex.load();
+
+    if (w == r)
+      return 0;
+  }
+
+  // Lapped by a free-running writer.  Jump to the oldest data still there.
+  if (w - r > capacity) {
+    uint64_t newr = w - capacity;
+    missed += newr - r;
+    r = newr;
+  }
+
+  size_t n = std::min((uint64_t)maxbytes, w - r);
+  n -= n % itemsize;
+
+  if (n == 0)
+    return 0;
+
+  size_t pos = r % capacity;
+  size_t first = std::min((uint64_t)n, capacity - pos);
+
+  memcpy(buffer, &d_data[pos], first);
+  if (n > first)
+    memcpy(&buffer[first], d_data, n - first);
+
+  // If the writer had started overwriting any of what we just copied, the
+  // copy can't be trusted.  Drop it and resync on the next call.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  uint64_t reserve = d_header->writeReserve.load(std::memory_order_relaxed);
+
+  if (reserve - r > capacity) {
+    missed += n;
+    slot.readIndex.store(r + n, std::memory_order_release);
+    return 0;
+  }
+
+  slot.readIndex.store(r + n, std::memory_order_release);
+
+  // Keep the readIndex store ahead of the writerWaiting load (store-load
+  // reordering is allowed even on x86), or a lossless writer can miss its
+  // wakeup and sleep out the full timeout.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (d_header->writerWaiting.load()) {
+    d_header->readSeq.fetch_add(1);
+    futex_wake(&d_header->readSeq);
+  }
+
+  return n;
+}
+
+void shm_ring::close() {
+  if (!d_header) {
+    unmap();
+    return;
+  }
+
+  if (d_writer) {
+    // Let readers drain what's left and then see we're gone.
+    d_header->writerAlive.store(0);
+    d_header->writeSeq.fetch_add(1);
+    futex_wake(&d_header->writeSeq);
+
+    unmap();
+
+    // Readers that are attached keep their mapping.  A new writer gets a
+    // fresh segment.
+    shm_unlink(d_name.c_str());
+  } else {
+    if (d_slot >= 0) {
+      d_header->readers[d_slot].state.store(SHM_SLOT_FREE);
+      d_slot = -1;
+
+      // Don't leave a lossless writer waiting on a reader that's gone.
+      // Fenced as in read().
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      if (d_header->writerWaiting.load()) {
+        d_header->readSeq.fetch_add(1);
+        futex_wake(&d_header->readSeq);
+      }
+    }
+
+    unmap();
+  }
+}
+
+bool shm_ring::writer_alive() const {
+  return d_header && d_header->writerAlive.load();
+}
+
+bool shm_ring::data_available() const {
+  if (!d_header || d_slot < 0)
+    return false;
+
+  return d_header->writeIndex.load() !=
+         d_header->readers[d_slot].readIndex.load();
+}
+
+int shm_ring::active_readers() const {
+  if (!d_header)
+    return 0;
+
+  int count = 0;
+
+  for (int i = 0; i < SHM_RING_MAX_READERS; i++) {
+    if (d_header->readers[i].state.load() == SHM_SLOT_ACTIVE)
+      count++;
+  }
+
+  return count;
+}
+
+} // namespace grnet
+} // namespace gr
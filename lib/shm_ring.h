@@ -0,0 +1,137 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_SHM_RING_H
+#define INCLUDED_GRNET_SHM_RING_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#define SHM_RING_MAGIC 0x474E5253 // "SRNG"
+#define SHM_RING_VERSION 1
+#define SHM_RING_MAX_READERS 16
+#define SHM_RING_DATA_OFFSET 4096 // Header page, then the data ring
+
+#define SHM_SLOT_FREE 0
+#define SHM_SLOT_CLAIMED 1 // Reader is setting up its read index
+#define SHM_SLOT_ACTIVE 2
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Single-producer, multi-consumer byte ring in POSIX shared memory, used by
+ * shm_sink/shm_source to stream between processes on the same host.
+ *
+ * Indices are free-running 64-bit byte counts (the stream position doubles
+ * as the sequence number), so "bytes available" is just write - read.  The
+ * writer publishes writeIndex after copying in; each reader owns a slot
+ * with its own readIndex.  Nothing on the fast path makes a syscall.  A
+ * side that has to wait sleeps on a futex in the shared header, and the
+ * other side only calls FUTEX_WAKE when the waiting counter says someone
+ * is actually asleep.
+ *
+ * In lossless mode the writer never passes the slowest reader.  Otherwise
+ * the writer free-runs and a reader that gets lapped skips ahead and
+ * reports the bytes it missed.  writeReserve is published before the
+ * writer copies, seqlock style, so a reader can tell if the region it just
+ * copied was being overwritten underneath it.
+ */
+
+struct alignas(64) shm_ring_reader_slot {
+  std::atomic<uint32_t> state; // SHM_SLOT_*
+  std::atomic<int32_t> pid;
+  std::atomic<uint64_t> readIndex;
+};
+
+struct shm_ring_header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t itemsize;
+  uint64_t capacity; // bytes, multiple of itemsize
+
+  alignas(64) std::atomic<uint64_t> writeIndex;
+  std::atomic<uint64_t> writeReserve;
+  std::atomic<uint32_t> writeSeq; // futex word readers sleep on
+  std::atomic<uint32_t> readersWaiting;
+  std::atomic<uint32_t> writerAlive;
+  std::atomic<uint32_t> generation;
+
+  alignas(64) std::atomic<uint32_t> readSeq; // futex word the writer sleeps on
+  std::atomic<uint32_t> writerWaiting;
+
+  shm_ring_reader_slot readers[SHM_RING_MAX_READERS];
+};
+
+class shm_ring {
+private:
+  std::string d_name;
+  int d_fd;
+  char *d_map;
+  size_t d_map_size;
+  shm_ring_header *d_header;
+  char *d_data;
+  int d_slot;
+  bool d_writer;
+
+  void unmap();
+  uint64_t slowest_reader(uint64_t writeIndex);
+  void reclaim_dead_readers();
+
+public:
+  shm_ring();
+  ~shm_ring();
+
+  // POSIX names need a leading '/'.
+  static std::string normalize_name(const std::string &name);
+
+  // Writer side.  Creates (or takes over a compatible) segment.  Throws
+  // std::runtime_error on failure.
+  void create(const std::string &name, size_t itemsize, size_t capacity);
+
+  // Copy in as many whole items as fit, waiting up to timeout_ms for room
+  // in lossless mode.  Returns bytes written.
+  size_t write(const char *buffer, size_t bytes, bool lossless,
+               int timeout_ms);
+
+  // Reader side.  Returns false if the segment doesn't exist yet (or the
+  // writer is still setting it up).  Throws on an incompatible segment or
+  // when all reader slots are taken.
+  bool open(const std::string &name, size_t itemsize);
+
+  // Copy out up to maxbytes of whole items, waiting up to timeout_ms for
+  // data.  Bytes skipped because the writer lapped us are added to missed.
+  size_t read(char *buffer, size_t maxbytes, int timeout_ms,
+              uint64_t &missed);
+
+  void close();
+
+  bool is_open() const { return d_header != NULL; }
+  bool writer_alive() const;
+  bool data_available() const;
+  int active_readers() const;
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_SHM_RING_H */
@@ -0,0 +1,96 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_sink_impl.h"
+#include <gnuradio/io_signature.h>
+#include <sstream>
+
+namespace gr {
+namespace grnet {
+
+shm_sink::sptr shm_sink::make(size_t itemsize, size_t vecLen,
+                              const std::string &name, size_t ringSize,
+                              bool lossless) {
+  return gnuradio::get_initial_sptr(
+      new shm_sink_impl(itemsize, vecLen, name, ringSize, lossless));
+}
+
+/*
+ * The private constructor
+ */
+shm_sink_impl::shm_sink_impl(size_t itemsize, size_t vecLen,
+                             const std::string &name, size_t ringSize,
+                             bool lossless)
+    : gr::sync_block("shm_sink",
+                     gr::io_signature::make(1, 1, itemsize * vecLen),
+                     gr::io_signature::make(0, 0, 0)),
+      d_itemsize(itemsize), d_veclen(vecLen), d_name(name),
+      d_ring_size(ringSize), d_lossless(lossless) {
+  d_block_size = d_itemsize * d_veclen;
+
+  if (d_name.empty())
+    throw std::runtime_error("[Shared Memory Sink] A ring name is required.");
+
+  if (d_ring_size < d_block_size)
+    throw std::runtime_error(
+        "[Shared Memory Sink] Ring size must hold at least one item.");
+}
+
+/*
+ * Our virtual destructor.
+ */
+shm_sink_impl::~shm_sink_impl() { stop(); }
+
+bool shm_sink_impl::start() {
+  d_ring.create(d_name, d_block_size, d_ring_size);
+
+  std::stringstream msg;
+  msg << "Streaming to shared memory " << shm_ring::normalize_name(d_name)
+      << (d_lossless ? " (lossless)." : ".");
+  GR_LOG_INFO(d_logger, msg.str());
+
+  return true;
+}
+
+bool shm_sink_impl::stop() {
+  d_ring.close();
+  return true;
+}
+
+int shm_sink_impl::work(int noutput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items) {
+  const char *in = (const char *)input_items[0];
+
+  // In lossless mode this waits (on a futex, not polling) for the slowest
+  // reader to make room.  The timeout just keeps the scheduler responsive;
+  // returning 0 means try again.
+  size_t bytesWritten =
+      d_ring.write(in, noutput_items * d_block_size, d_lossless, 100);
+
+  return bytesWritten / d_block_size;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
@@ -0,0 +1,115 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm_source_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/thread/thread.hpp>
+#include <sstream>
+
+namespace gr {
+namespace grnet {
+
+shm_source::sptr shm_source::make(size_t itemsize, size_t vecLen,
+                                  const std::string &name,
+                                  bool notifyMissed) {
+  return gnuradio::get_initial_sptr(
+      new shm_source_impl(itemsize, vecLen, name, notifyMissed));
+}
+
+/*
+ * The private constructor
+ */
+shm_source_impl::shm_source_impl(size_t itemsize, size_t vecLen,
+                                 const std::string &name, bool notifyMissed)
+    : gr::sync_block("shm_source", gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(1, 1, itemsize * vecLen)),
+      d_itemsize(itemsize), d_veclen(vecLen), d_name(name),
+      d_notifyMissed(notifyMissed), d_waiting_reported(false),
+      d_missed_bytes(0) {
+  d_block_size = d_itemsize * d_veclen;
+
+  if (d_name.empty())
+    throw std::runtime_error(
+        "[Shared Memory Source] A ring name is required.");
+}
+
+/*
+ * Our virtual destructor.
+ */
+shm_source_impl::~shm_source_impl() { stop(); }
+
+bool shm_source_impl::stop() {
+  d_ring.close();
+  return true;
+}
+
+int shm_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star &input_items,
+                          gr_vector_void_star &output_items) {
+  if (!d_ring.is_open()) {
+    if (!d_ring.open(d_name, d_block_size)) {
+      if (!d_waiting_reported) {
+        std::stringstream msg;
+        msg << "Waiting for shared memory " << shm_ring::normalize_name(d_name)
+            << " to be created.";
+        GR_LOG_INFO(d_logger, msg.str());
+        d_waiting_reported = true;
+      }
+
+      // Interruptible, so a flowgraph stop isn't held up.
+      boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+      return 0;
+    }
+
+    GR_LOG_INFO(d_logger, "Attached to shared memory ring.");
+  }
+
+  char *out = (char *)output_items[0];
+  uint64_t missed = 0;
+
+  // Straight into the output buffer.  Sleeps on a futex until the writer
+  // publishes something (or the timeout passes).
+  size_t bytesRead =
+      d_ring.read(out, noutput_items * d_block_size, 100, missed);
+
+  if (missed > 0) {
+    d_missed_bytes += missed;
+
+    if (d_notifyMissed) {
+      std::stringstream msg;
+      msg << "[Shared Memory Source] missed items: " << missed / d_block_size;
+      GR_LOG_WARN(d_logger, msg.str());
+    }
+  }
+
+  if (bytesRead == 0 && !d_ring.writer_alive() && !d_ring.data_available()) {
+    GR_LOG_INFO(d_logger, "Shared memory sink stopped.");
+    return WORK_DONE;
+  }
+
+  return bytesRead / d_block_size;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
@@ -0,0 +1,61 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_SHM_SOURCE_IMPL_H
+#define INCLUDED_GRNET_SHM_SOURCE_IMPL_H
+
+#include <grnet/shm_source.h>
+
+#include "shm_ring.h"
+
+namespace gr {
+namespace grnet {
+
+class GRNET_API shm_source_impl : public shm_source {
+protected:
+  size_t d_itemsize;
+  size_t d_veclen;
+  size_t d_block_size;
+
+  std::string d_name;
+  bool d_notifyMissed;
+
+  shm_ring d_ring;
+  bool d_waiting_reported;
+  uint64_t d_missed_bytes;
+
+public:
+  shm_source_impl(size_t itemsize, size_t vecLen, const std::string &name,
+                  bool notifyMissed);
+  ~shm_source_impl();
+
+  virtual bool stop();
+
+  uint64_t items_missed() const { return d_missed_bytes / d_block_size; }
+
+  // Where all the action really happens
+  int work(int noutput_items, gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_SHM_SOURCE_IMPL_H */
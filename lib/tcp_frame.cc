@@ -0,0 +1,90 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tcp_frame.h"
+#include <string.h>
+#include <string>
+
+namespace gr {
+namespace grnet {
+
+static inline void append_u32(std::vector<char> &buffer, uint32_t value) {
+  const char *p = (const char *)&value;
+  buffer.insert(buffer.end(), p, p + sizeof(value));
+}
+
+void serialize_frame_tags(const std::vector<gr::tag_t> &tags,
+                          uint64_t first_item, std::vector<char> &buffer) {
+  buffer.clear();
+
+  for (size_t i = 0; i < tags.size(); i++) {
+    std::string key = pmt::serialize_str(tags[i].key);
+    std::string value = pmt::serialize_str(tags[i].value);
+
+    append_u32(buffer, (uint32_t)(tags[i].offset - first_item));
+    append_u32(buffer, key.size());
+    append_u32(buffer, value.size());
+    buffer.insert(buffer.end(), key.begin(), key.end());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+  }
+}
+
+bool deserialize_frame_tags(const char *buffer, size_t len,
+                            std::vector<frame_tag> &tags) {
+  tags.clear();
+
+  size_t pos = 0;
+  const size_t entryHeader = 3 * sizeof(uint32_t);
+
+  while (pos < len) {
+    if (len - pos < entryHeader)
+      return false;
+
+    uint32_t fields[3];
+    memcpy(fields, &buffer[pos], entryHeader);
+    pos += entryHeader;
+
+    if ((size_t)fields[1] + fields[2] > len - pos)
+      return false;
+
+    frame_tag tag;
+    tag.offset = fields[0];
+
+    try {
+      tag.key = pmt::deserialize_str(std::string(&buffer[pos], fields[1]));
+      pos += fields[1];
+      tag.value = pmt::deserialize_str(std::string(&buffer[pos], fields[2]));
+      pos += fields[2];
+    } catch (const std::exception &ex) {
+      return false;
+    }
+
+    tags.push_back(tag);
+  }
+
+  return true;
+}
+
+} // namespace grnet
+} // namespace gr
@@ -0,0 +1,105 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_TCP_FRAME_H
+#define INCLUDED_GRNET_TCP_FRAME_H
+
+#include <gnuradio/tags.h>
+#include <grnet/tcp_sink.h>
+#include <stdint.h>
+#include <vector>
+
+/*
+ * Frame format shared by tcp_sink (framed modes) and tcp_framed_source.
+ *
+ * Each frame is written with a single writev():
+ *
+ *   TcpFrameHeader  (40 bytes, host byte order like the UDP headers)
+ *   tag block       (tagBytes bytes)
+ *   payload         (itemCount * itemSize bytes)
+ *
+ * The tag block is a run of entries:
+ *
+ *   uint32_t offset      item offset relative to the first item in the frame
+ *   uint32_t keyLen
+ *   uint32_t valueLen
+ *   key                  pmt::serialize_str() of the tag key
+ *   value                pmt::serialize_str() of the tag value
+ *
+ * The magic word lets a receiver find the next frame boundary if it ever
+ * loses sync.  The sink only writes whole frames to a connection, so a
+ * client that reconnects always starts on a frame boundary.
+ */
+
+#define TCPFRAME_MAGIC 0x464E5247 // "GRNF" on the wire (little-endian)
+#define TCPFRAME_VERSION 1
+
+#define TCPFRAME_FLAG_TIMESTAMP 0x01 // timestampNs holds the send time
+
+class TcpFrameHeader {
+public:
+  // size: 40
+  uint32_t magic;
+  uint8_t version;
+  uint8_t flags;
+  uint16_t headerSize;
+  uint64_t seqnum;
+  uint64_t timestampNs; // UNIX epoch nanoseconds when flagged
+  uint32_t itemSize;
+  uint32_t itemCount;
+  uint32_t tagBytes;
+  uint32_t reserved;
+
+  TcpFrameHeader() {
+    magic = TCPFRAME_MAGIC;
+    version = TCPFRAME_VERSION;
+    flags = 0;
+    headerSize = sizeof(TcpFrameHeader);
+    seqnum = 0;
+    timestampNs = 0;
+    itemSize = 0;
+    itemCount = 0;
+    tagBytes = 0;
+    reserved = 0;
+  };
+};
+
+namespace gr {
+namespace grnet {
+
+struct frame_tag {
+  uint32_t offset;
+  pmt::pmt_t key;
+  pmt::pmt_t value;
+};
+
+// Serialize tags into buffer (replacing its contents).  Tag offsets are
+// stored relative to first_item.
+void serialize_frame_tags(const std::vector<gr::tag_t> &tags,
+                          uint64_t first_item, std::vector<char> &buffer);
+
+// Parse a tag block.  Returns false if the block is malformed.
+bool deserialize_frame_tags(const char *buffer, size_t len,
+                            std::vector<frame_tag> &tags);
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_TCP_FRAME_H */
@@ -0,0 +1,542 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tcp_framed_source_impl.h"
+#include <gnuradio/io_signature.h>
+#include <boost/format.hpp>
+#include <errno.h>
+#include <poll.h>
+#include <sstream>
+
+namespace gr {
+namespace grnet {
+
+tcp_framed_source::sptr tcp_framed_source::make(size_t itemsize, size_t vecLen,
+                                                const std::string &host,
+                                                int port, int sourceMode,
+                                                bool notifyMissed) {
+  return gnuradio::get_initial_sptr(new tcp_framed_source_impl(
+      itemsize, vecLen, host, port, sourceMode, notifyMissed));
+}
+
+/*
+ * The private constructor
+ */
+tcp_framed_source_impl::tcp_framed_source_impl(size_t itemsize, size_t vecLen,
+                                               const std::string &host,
+                                               int port, int sourceMode,
+                                               bool notifyMissed)
+    : gr::sync_block("tcp_framed_source", gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(1, 1, itemsize * vecLen)),
+      d_itemsize(itemsize), d_veclen(vecLen), d_sourcemode(sourceMode),
+      d_notifyMissed(notifyMissed), is_ipv6(false), d_host(host),
+      d_port(port), d_connected(false), d_stopping(false),
+      d_frame_items_left(0), d_last_seq(0), d_have_seq(false),
+      d_frames_received(0), d_frames_missed(0),
+      d_size_mismatch_reported(false) {
+  d_block_size = d_itemsize * d_veclen;
+  d_frame_time_key = pmt::mp("frame_time");
+
+  if (d_sourcemode == TCPSINKMODE_CLIENT) {
+    // Connecting to a tcp_sink running in server mode.
+    std::stringstream msg;
+
+    msg << "[TCP Framed Source] connecting to " << host << " on port "
+        << port;
+    GR_LOG_INFO(d_logger, msg.str());
+
+    boost::system::error_code err;
+    d_tcpsocket = new boost::asio::ip::tcp::socket(d_io_service);
+
+    std::string s_port = (boost::format("%d") % port).str();
+    boost::asio::ip::tcp::resolver resolver(d_io_service);
+    boost::asio::ip::tcp::resolver::query query(
+        d_host, s_port, boost::asio::ip::resolver_query_base::passive);
+
+    d_endpoint = *resolver.resolve(query, err);
+
+    if (err) {
+      throw std::runtime_error(
+          std::string("[TCP Framed Source] Unable to resolve host/IP: ") +
+          err.message());
+    }
+
+    is_ipv6 = d_endpoint.address().is_v6();
+
+    d_tcpsocket->connect(d_endpoint, err);
+    if (err) {
+      throw std::runtime_error(
+          std::string("[TCP Framed Source] Connection error: ") +
+          err.message());
+    }
+
+    boost::asio::socket_base::keep_alive option(true);
+    d_tcpsocket->set_option(option);
+
+    d_connected = true;
+  } else {
+    // Waiting for a tcp_sink in client mode to connect to us.
+    if (d_host.find(":") != std::string::npos)
+      is_ipv6 = true;
+    else
+      is_ipv6 = false;
+
+    boost::asio::ip::tcp::endpoint listen_endpoint;
+    if (is_ipv6)
+      listen_endpoint =
+          boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v6(), d_port);
+    else
+      listen_endpoint =
+          boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), d_port);
+
+    boost::system::error_code err;
+    d_acceptor = new boost::asio::ip::tcp::acceptor(d_io_service);
+    d_acceptor->open(listen_endpoint.protocol(), err);
+    if (!err)
+      d_acceptor->set_option(
+          boost::asio::ip::tcp::acceptor::reuse_address(true), err);
+    if (!err)
+      d_acceptor->bind(listen_endpoint, err);
+    if (!err)
+      d_acceptor->listen(boost::asio::socket_base::max_connections, err);
+
+    if (err) {
+      delete d_acceptor;
+      d_acceptor = NULL;
+      throw std::runtime_error(
+          std::string("[TCP Framed Source] Unable to listen on port ") +
+          std::to_string(d_port) + ": " + err.message());
+    }
+
+    d_io_work = new boost::asio::io_service::work(d_io_service);
+
+    start_accept();
+
+    d_listener_thread = new boost::thread(
+        boost::bind(&tcp_framed_source_impl::run_listener, this));
+  }
+}
+
+/*
+ * Our virtual destructor.
+ */
+tcp_framed_source_impl::~tcp_framed_source_impl() { stop(); }
+
+void tcp_framed_source_impl::run_listener() {
+  try {
+    d_io_service.run();
+  } catch (const std::exception &ex) {
+    std::stringstream msg;
+    msg << "Listener error: " << ex.what();
+    GR_LOG_ERROR(d_logger, msg.str());
+  }
+}
+
+void tcp_framed_source_impl::accept_handler(
+    boost::asio::ip::tcp::socket *new_connection,
+    const boost::system::error_code &error) {
+  if (!error) {
+    GR_LOG_INFO(d_logger, "Sender connected.");
+
+    gr::thread::scoped_lock guard(d_setlock);
+
+    d_tcpsocket = new_connection;
+
+    boost::asio::socket_base::keep_alive option(true);
+    d_tcpsocket->set_option(option);
+
+    // A new sender starts its own sequence numbers.
+    d_have_seq = false;
+    d_connected = true;
+
+    d_connected_cond.notify_all();
+  } else {
+    delete new_connection;
+
+    if (error == boost::asio::error::operation_aborted)
+      return;
+
+    std::stringstream msg;
+    msg << "Error code " << error << " accepting TCP session.";
+    GR_LOG_ERROR(d_logger, msg.str());
+
+    start_accept();
+  }
+}
+
+void tcp_framed_source_impl::start_accept() {
+  if (!d_acceptor || !d_acceptor->is_open())
+    return;
+
+  std::stringstream msg;
+  msg << "Waiting for connection on port " << d_port;
+  GR_LOG_INFO(d_logger, msg.str());
+
+  boost::asio::ip::tcp::socket *tmpSocket =
+      new boost::asio::ip::tcp::socket(d_io_service);
+  d_acceptor->async_accept(
+      *tmpSocket,
+      boost::bind(&tcp_framed_source_impl::accept_handler, this, tmpSocket,
+                  boost::asio::placeholders::error));
+}
+
+void tcp_framed_source_impl::close_acceptor() {
+  if (d_acceptor) {
+    boost::system::error_code err;
+    d_acceptor->close(err);
+  }
+}
+
+void tcp_framed_source_impl::drop_connection() {
+  gr::thread::scoped_lock guard(d_setlock);
+
+  d_connected = false;
+
+  // Anything left of the current frame went with the connection.
+  d_frame_items_left = 0;
+  d_pending_tags.clear();
+
+  if (d_tcpsocket) {
+    boost::system::error_code err;
+    d_tcpsocket->close(err);
+    delete d_tcpsocket;
+    d_tcpsocket = NULL;
+  }
+
+  if (d_sourcemode == TCPSINKMODE_SERVER && !d_stopping) {
+    GR_LOG_INFO(d_logger, "Sender disconnected. Waiting for new connection.");
+    d_io_service.post(boost::bind(&tcp_framed_source_impl::start_accept, this));
+  }
+}
+
+bool tcp_framed_source_impl::stop() {
+  d_stopping = true;
+
+  if (d_listener_thread) {
+    d_io_service.post(
+        boost::bind(&tcp_framed_source_impl::close_acceptor, this));
+
+    if (d_io_work) {
+      delete d_io_work;
+      d_io_work = NULL;
+    }
+
+    d_listener_thread->join();
+
+    delete d_listener_thread;
+    d_listener_thread = NULL;
+  }
+
+  d_io_service.stop();
+
+  if (d_acceptor) {
+    delete d_acceptor;
+    d_acceptor = NULL;
+  }
+
+  gr::thread::scoped_lock guard(d_setlock);
+
+  d_connected = false;
+  d_connected_cond.notify_all();
+
+  if (d_tcpsocket) {
+    boost::system::error_code err;
+    d_tcpsocket->close(err);
+    delete d_tcpsocket;
+    d_tcpsocket = NULL;
+  }
+
+  return true;
+}
+
+bool tcp_framed_source_impl::read_fully(int fd, char *buffer, size_t len) {
+  // Reads go straight into the caller's buffer (for payload, the output
+  // buffer).  poll() with a short timeout keeps the thread interruptible
+  // while the sender is idle.
+  while (len > 0) {
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    int rc = poll(&pfd, 1, 100);
+
+    if (d_stopping)
+      return false;
+
+    if (rc == 0) {
+      boost::this_thread::interruption_point();
+      continue;
+    }
+
+    if (rc < 0) {
+      if (errno == EINTR)
+        continue;
+
+      return false;
+    }
+
+    ssize_t bytesRead = recv(fd, buffer, len, 0);
+
+    if (bytesRead == 0)
+      return false; // Orderly shutdown by the sender
+
+    if (bytesRead < 0) {
+      if (errno == EINTR || errno == EAGAIN)
+        continue;
+
+      return false;
+    }
+
+    buffer += bytesRead;
+    len -= bytesRead;
+  }
+
+  return true;
+}
+
+bool tcp_framed_source_impl::skip_bytes(int fd, size_t len) {
+  char discard[4096];
+
+  while (len > 0) {
+    size_t chunk = std::min(len, sizeof(discard));
+
+    if (!read_fully(fd, discard, chunk))
+      return false;
+
+    len -= chunk;
+  }
+
+  return true;
+}
+
+bool tcp_framed_source_impl::valid_header() const {
+  return (d_header.magic == TCPFRAME_MAGIC) &&
+         (d_header.version == TCPFRAME_VERSION) &&
+         (d_header.headerSize >= sizeof(TcpFrameHeader)) &&
+         (d_header.tagBytes <= TCPFRAME_MAX_TAG_BYTES);
+}
+
+bool tcp_framed_source_impl::read_frame_header(int fd, uint64_t frameStart) {
+  char *pHeader = (char *)&d_header;
+
+  if (!read_fully(fd, pHeader, sizeof(d_header)))
+    return false;
+
+  // Lost sync: slide forward a byte at a time until a header lines up.
+  // This only happens on corruption, so the per-byte reads don't matter.
+  uint64_t skipped = 0;
+
+  while (!valid_header()) {
+    memmove(pHeader, pHeader + 1, sizeof(d_header) - 1);
+
+    if (!read_fully(fd, pHeader + sizeof(d_header) - 1, 1))
+      return false;
+
+    skipped++;
+  }
+
+  if (skipped > 0) {
+    std::stringstream msg;
+    msg << "Lost frame sync.  Skipped " << skipped
+        << " bytes to the next frame.";
+    GR_LOG_WARN(d_logger, msg.str());
+  }
+
+  // Newer senders may carry a longer header.  Skip what we don't know.
+  if (!skip_bytes(fd, d_header.headerSize - sizeof(d_header)))
+    return false;
+
+  d_frames_received++;
+
+  if (d_have_seq && d_header.seqnum != d_last_seq + 1) {
+    uint64_t missed = d_header.seqnum - d_last_seq - 1;
+
+    // A backwards jump means the sender restarted.  Nothing we can count.
+    if (d_header.seqnum > d_last_seq) {
+      d_frames_missed += missed;
+
+      if (d_notifyMissed) {
+        std::stringstream msg;
+        msg << "[TCP Framed Source] missed frames: " << missed;
+        GR_LOG_WARN(d_logger, msg.str());
+      }
+    }
+  }
+
+  d_last_seq = d_header.seqnum;
+  d_have_seq = true;
+
+  d_tag_buffer.resize(d_header.tagBytes);
+
+  if (d_header.tagBytes > 0 &&
+      !read_fully(fd, &d_tag_buffer[0], d_header.tagBytes))
+    return false;
+
+  if (d_header.itemSize != d_block_size) {
+    if (!d_size_mismatch_reported) {
+      std::stringstream msg;
+      msg << "Sender item size " << d_header.itemSize
+          << " does not match block item size " << d_block_size
+          << ".  Dropping frames.";
+      GR_LOG_ERROR(d_logger, msg.str());
+      d_size_mismatch_reported = true;
+    }
+
+    return skip_bytes(fd, (size_t)d_header.itemCount * d_header.itemSize);
+  }
+
+  if (d_header.tagBytes > 0 &&
+      !deserialize_frame_tags(&d_tag_buffer[0], d_tag_buffer.size(),
+                              d_frame_tags)) {
+    GR_LOG_WARN(d_logger, "Malformed tag block.  Frame tags dropped.");
+    d_frame_tags.clear();
+  } else if (d_header.tagBytes == 0) {
+    d_frame_tags.clear();
+  }
+
+  for (size_t i = 0; i < d_frame_tags.size(); i++) {
+    if (d_frame_tags[i].offset >= d_header.itemCount)
+      continue;
+
+    gr::tag_t tag;
+    tag.offset = frameStart + d_frame_tags[i].offset;
+    tag.key = d_frame_tags[i].key;
+    tag.value = d_frame_tags[i].value;
+    tag.srcid = alias_pmt();
+    d_pending_tags.push_back(tag);
+  }
+
+  if (d_header.flags & TCPFRAME_FLAG_TIMESTAMP) {
+    gr::tag_t tag;
+    tag.offset = frameStart;
+    tag.key = d_frame_time_key;
+    tag.value = pmt::make_tuple(
+        pmt::from_uint64(d_header.timestampNs / 1000000000ULL),
+        pmt::from_double((d_header.timestampNs % 1000000000ULL) * 1e-9));
+    tag.srcid = alias_pmt();
+    d_pending_tags.push_back(tag);
+  }
+
+  d_frame_items_left = d_header.itemCount;
+
+  return true;
+}
+
+void tcp_framed_source_impl::emit_tags(uint64_t endItem) {
+  // A frame can span several work() calls, so tags are held until the
+  // samples they belong to have been produced.
+  size_t emitted = 0;
+
+  while (emitted < d_pending_tags.size() &&
+         d_pending_tags[emitted].offset < endItem) {
+    add_item_tag(0, d_pending_tags[emitted]);
+    emitted++;
+  }
+
+  if (emitted > 0)
+    d_pending_tags.erase(d_pending_tags.begin(),
+                         d_pending_tags.begin() + emitted);
+}
+
+int tcp_framed_source_impl::work(int noutput_items,
+                                 gr_vector_const_void_star &input_items,
+                                 gr_vector_void_star &output_items) {
+  int fd;
+
+  {
+    gr::thread::scoped_lock guard(d_setlock);
+
+    if (!d_connected) {
+      if (d_sourcemode == TCPSINKMODE_CLIENT || d_stopping)
+        return WORK_DONE;
+
+      // Server mode: sleep until a sender shows up rather than spinning.
+      d_connected_cond.timed_wait(guard,
+                                  boost::posix_time::milliseconds(100));
+
+      if (!d_connected)
+        return 0;
+    }
+
+    fd = d_tcpsocket->native_handle();
+  }
+
+  char *out = (char *)output_items[0];
+  uint64_t firstItem = nitems_written(0);
+  int produced = 0;
+  bool connectionLost = false;
+
+  while (produced < noutput_items) {
+    if (d_frame_items_left == 0) {
+      // Don't sit waiting for the next frame with samples in hand.
+      if (produced > 0) {
+        struct pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        if (poll(&pfd, 1, 0) <= 0)
+          break;
+      }
+
+      if (!read_frame_header(fd, firstItem + produced)) {
+        connectionLost = true;
+        break;
+      }
+
+      continue;
+    }
+
+    size_t items = std::min(d_frame_items_left,
+                            (size_t)(noutput_items - produced));
+
+    if (!read_fully(fd, &out[produced * d_block_size], items * d_block_size)) {
+      connectionLost = true;
+      break;
+    }
+
+    produced += items;
+    d_frame_items_left -= items;
+  }
+
+  emit_tags(firstItem + produced);
+
+  if (connectionLost) {
+    drop_connection();
+
+    if (d_sourcemode == TCPSINKMODE_CLIENT) {
+      GR_LOG_WARN(d_logger, "Sender closed the connection.  Stopping.");
+
+      // Hand over what we have.  The next call sees the closed connection.
+      if (produced == 0)
+        return WORK_DONE;
+    }
+  }
+
+  return produced;
+}
+
+} /* namespace grnet */
+} /* namespace gr */
@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_TCP_FRAMED_SOURCE_IMPL_H
+#define INCLUDED_GRNET_TCP_FRAMED_SOURCE_IMPL_H
+
+#include <boost/asio.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/thread/thread.hpp>
+#include <grnet/tcp_framed_source.h>
+
+#include "tcp_frame.h"
+
+// Anything claiming a bigger tag block than this is treated as a corrupt
+// header rather than allocated.
+#define TCPFRAME_MAX_TAG_BYTES (16 * 1024 * 1024)
+
+namespace gr {
+namespace grnet {
+
+class GRNET_API tcp_framed_source_impl : public tcp_framed_source {
+protected:
+  size_t d_itemsize;
+  size_t d_veclen;
+  size_t d_block_size;
+  int d_sourcemode;
+  bool d_notifyMissed;
+  bool is_ipv6;
+
+  // Server mode uses the same listener arrangement as tcp_sink: a thread
+  // parked in io_service::run() handling (re)accepts.
+  boost::asio::io_service d_io_service;
+  boost::asio::io_service::work *d_io_work = NULL;
+  boost::asio::ip::tcp::endpoint d_endpoint;
+  boost::asio::ip::tcp::socket *d_tcpsocket = NULL;
+  boost::asio::ip::tcp::acceptor *d_acceptor = NULL;
+
+  boost::thread *d_listener_thread = NULL;
+  gr::thread::condition_variable d_connected_cond;
+
+  std::string d_host;
+  int d_port;
+
+  bool d_connected;
+  bool d_stopping;
+
+  // Current frame
+  TcpFrameHeader d_header;
+  size_t d_frame_items_left;
+  std::vector<char> d_tag_buffer;
+  std::vector<frame_tag> d_frame_tags;
+  std::vector<gr::tag_t> d_pending_tags;
+
+  uint64_t d_last_seq;
+  bool d_have_seq;
+  uint64_t d_frames_received;
+  uint64_t d_frames_missed;
+  bool d_size_mismatch_reported;
+
+  pmt::pmt_t d_frame_time_key;
+
+  bool read_fully(int fd, char *buffer, size_t len);
+  bool skip_bytes(int fd, size_t len);
+  bool valid_header() const;
+  bool read_frame_header(int fd, uint64_t frameStart);
+  void emit_tags(uint64_t endItem);
+  void drop_connection();
+
+  virtual void start_accept();
+  void close_acceptor();
+  virtual void run_listener();
+
+public:
+  tcp_framed_source_impl(size_t itemsize, size_t vecLen,
+                         const std::string &host, int port,
+                         int sourceMode = TCPSINKMODE_CLIENT,
+                         bool notifyMissed = true);
+  ~tcp_framed_source_impl();
+
+  virtual bool stop();
+
+  uint64_t frames_received() const { return d_frames_received; }
+  uint64_t frames_missed() const { return d_frames_missed; }
+
+  void accept_handler(boost::asio::ip::tcp::socket *new_connection,
+                      const boost::system::error_code &error);
+
+  // Where all the action really happens
+  int work(int noutput_items, gr_vector_const_void_star &input_items,
+           gr_vector_void_star &output_items);
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_TCP_FRAMED_SOURCE_IMPL_H */
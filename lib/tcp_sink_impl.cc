@@ -25,31 +25,56 @@
 #include "tcp_sink_impl.h"
 #include <gnuradio/io_signature.h>
 #include <boost/format.hpp>
+#include <netinet/tcp.h>
 #include <sstream>
 
 namespace gr {
 namespace grnet {
 
 tcp_sink::sptr tcp_sink::make(size_t itemsize, size_t vecLen,
-                              const std::string &host, int port, int sinkMode) {
-  return gnuradio::get_initial_sptr(
-      new tcp_sink_impl(itemsize, vecLen, host, port, sinkMode));
+                              const std::string &host, int port, int sinkMode,
+                              bool zerocopy, int profile, int coalesceSize,
+                              int coalesceTimeoutUs, int frameMode) {
+  return gnuradio::get_initial_sptr(new tcp_sink_impl(
+      itemsize, vecLen, host, port, sinkMode, zerocopy, profile, coalesceSize,
+      coalesceTimeoutUs, frameMode));
 }
 
 /*
  * The private constructor
  */
 tcp_sink_impl::tcp_sink_impl(size_t itemsize, size_t vecLen,
-                             const std::string &host, int port, int sinkMode)
+                             const std::string &host, int port, int sinkMode,
+                             bool zerocopy, int profile, int coalesceSize,
+                             int coalesceTimeoutUs, int frameMode)
     : gr::sync_block("tcp_sink",
                      gr::io_signature::make(1, 1, itemsize * vecLen),
                      gr::io_signature::make(0, 0, 0)),
       d_itemsize(itemsize), d_veclen(vecLen), d_port(port), d_host(host),
-      d_sinkmode(sinkMode), d_thread_running(false), d_stop_thread(false),
-      d_listener_thread(NULL), d_start_new_listener(false),
-      d_initial_connection(true) {
+      d_sinkmode(sinkMode), d_listener_thread(NULL), d_connected(false),
+      d_zerocopy(zerocopy), d_zc_sent_unconsumed(0),
+      d_zc_completed_unconsumed(0), d_profile(profile), d_coalesce_size(0),
+      d_coalesce_timeout_us(coalesceTimeoutUs),
+      d_coalesce_timer(d_io_service), d_write_count(0),
+      d_write_bytes(0), d_frame_mode(frameMode), d_frame_seq(0) {
   d_block_size = d_itemsize * d_veclen;
 
+  if (d_frame_mode != TCPFRAMEMODE_NONE && d_zerocopy) {
+    GR_LOG_WARN(d_logger, "Zerocopy is not supported with framing.  Frames "
+                          "will be sent with writev().");
+    d_zerocopy = false;
+  }
+
+  // Coalescing only applies to the throughput profile.  Zerocopy already
+  // hands everything available to the kernel in one send, and in framed
+  // mode each work() call is its own frame.
+  if (d_frame_mode == TCPFRAMEMODE_NONE &&
+      d_profile == TCPSINKPROFILE_THROUGHPUT && !d_zerocopy &&
+      coalesceSize > 0) {
+    d_coalesce_size = coalesceSize;
+    d_coalesce_buffer.reserve(d_coalesce_size);
+  }
+
   if (d_sinkmode == TCPSINKMODE_CLIENT) {
     // In this mode, we're connecting to a remote TCP service listener
     // as a client.
@@ -95,29 +120,80 @@ tcp_sink_impl::tcp_sink_impl(size_t itemsize, size_t vecLen,
 
     boost::asio::socket_base::keep_alive option(true);
     d_tcpsocket->set_option(option);
+
+    apply_profile();
+    attach_zerocopy();
   } else {
     // In this mode, we're starting a local port listener and waiting
     // for inbound connections.
-    d_start_new_listener = true;
+    if (d_host.find(":") != std::string::npos)
+      is_ipv6 = true;
+    else
+      is_ipv6 = false;
+
+    boost::asio::ip::tcp::endpoint listen_endpoint;
+    if (is_ipv6)
+      listen_endpoint =
+          boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v6(), d_port);
+    else
+      listen_endpoint =
+          boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), d_port);
+
+    // Open/bind/listen by hand rather than through the acceptor's endpoint
+    // constructor so SO_REUSEADDR is set before bind().  Without it a
+    // restarted flowgraph can't rebind while the previous listener's
+    // connections are still in TIME_WAIT.
+    boost::system::error_code err;
+    d_acceptor = new boost::asio::ip::tcp::acceptor(d_io_service);
+    d_acceptor->open(listen_endpoint.protocol(), err);
+    if (!err)
+      d_acceptor->set_option(
+          boost::asio::ip::tcp::acceptor::reuse_address(true), err);
+    if (!err)
+      d_acceptor->bind(listen_endpoint, err);
+    if (!err)
+      d_acceptor->listen(boost::asio::socket_base::max_connections, err);
+
+    if (err) {
+      delete d_acceptor;
+      d_acceptor = NULL;
+      throw std::runtime_error(
+          std::string("[TCP Sink] Unable to listen on port ") +
+          std::to_string(d_port) + ": " + err.message());
+    }
+
+    d_io_work = new boost::asio::io_service::work(d_io_service);
+
+    start_accept();
+
+    d_listener_thread =
+        new boost::thread(boost::bind(&tcp_sink_impl::run_listener, this));
+  }
+
+  // The coalesce deadline is a timer on the io_service, so a client needs
+  // the listener thread too.  Otherwise a partial buffer would sit there
+  // until the next work() call, which may never come if upstream goes
+  // quiet.
+  if (d_coalesce_size > 0 && !d_listener_thread) {
+    d_io_work = new boost::asio::io_service::work(d_io_service);
+
     d_listener_thread =
         new boost::thread(boost::bind(&tcp_sink_impl::run_listener, this));
   }
 }
 
 void tcp_sink_impl::run_listener() {
-  d_thread_running = true;
-
-  while (!d_stop_thread) {
-    // this will block
-    if (d_start_new_listener) {
-      d_start_new_listener = false;
-      connect(d_initial_connection);
-      d_initial_connection = false;
-    } else
-      usleep(10);
+  // Everything in server mode (accepts and re-accepts after a client drops)
+  // and the coalesce deadline are dispatched from here.  run() sleeps in
+  // the reactor until there is something to do and returns once stop() is
+  // called.
+  try {
+    d_io_service.run();
+  } catch (const std::exception &ex) {
+    std::stringstream msg;
+    msg << "Listener error: " << ex.what();
+    GR_LOG_ERROR(d_logger, msg.str());
   }
-
-  d_thread_running = false;
 }
 
 void tcp_sink_impl::accept_handler(boost::asio::ip::tcp::socket *new_connection,
@@ -125,62 +201,134 @@ void tcp_sink_impl::accept_handler(boost::asio::ip::tcp::socket *new_connection,
   if (!error) {
     GR_LOG_INFO(d_logger, "Client connection received.");
 
+    gr::thread::scoped_lock guard(d_setlock);
+
     // Accept succeeded.
     d_tcpsocket = new_connection;
 
     boost::asio::socket_base::keep_alive option(true);
     d_tcpsocket->set_option(option);
+
+    apply_profile();
+    attach_zerocopy();
     d_connected = true;
 
   } else {
+    // Boost made a copy so we have to clean up
+    delete new_connection;
+
+    // Aborted means the acceptor was closed in stop().  Nothing to report
+    // and nothing to re-arm.
+    if (error == boost::asio::error::operation_aborted)
+      return;
+
     std::stringstream msg;
     msg << "Error code " << error << " accepting TCP session.";
     GR_LOG_ERROR(d_logger, msg.str());
 
-    // Boost made a copy so we have to clean up
-    delete new_connection;
-
-    // safety settings.
-    d_connected = false;
-    d_tcpsocket = NULL;
+    // Transient accept failure (e.g. the client reset before we got to it).
+    // Go back to waiting.
+    start_accept();
   }
 }
 
-void tcp_sink_impl::connect(bool initial_connection) {
+void tcp_sink_impl::start_accept() {
+  // Always called either before the listener thread starts or from the
+  // listener thread itself, so the acceptor is only ever touched by one
+  // thread at a time.
+  if (!d_acceptor || !d_acceptor->is_open())
+    return;
+
   std::stringstream msg;
   msg << "Waiting for connection on port " << d_port;
   GR_LOG_INFO(d_logger, msg.str());
 
-  if (initial_connection) {
-    if (is_ipv6)
-      d_acceptor = new boost::asio::ip::tcp::acceptor(
-          d_io_service,
-          boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v6(), d_port));
-    else
-      d_acceptor = new boost::asio::ip::tcp::acceptor(
-          d_io_service,
-          boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), d_port));
-  } else {
-    d_io_service.reset();
-  }
-
-  if (d_tcpsocket) {
-    delete d_tcpsocket;
-  }
-  d_tcpsocket = NULL;
-  d_connected = false;
-
   boost::asio::ip::tcp::socket *tmpSocket =
       new boost::asio::ip::tcp::socket(d_io_service);
   d_acceptor->async_accept(
       *tmpSocket, boost::bind(&tcp_sink_impl::accept_handler, this, tmpSocket,
                               boost::asio::placeholders::error));
+}
 
-  if (initial_connection) {
-    d_io_service.run();
-  } else {
-    d_io_service.run();
+void tcp_sink_impl::apply_profile() {
+  boost::system::error_code err;
+
+  switch (d_profile) {
+  case TCPSINKPROFILE_LATENCY: {
+    // Don't let Nagle hold small writes back waiting for ACKs.
+    d_tcpsocket->set_option(boost::asio::ip::tcp::no_delay(true), err);
+  } break;
+
+  case TCPSINKPROFILE_THROUGHPUT: {
+    // Only ever put full segments on the wire and give the kernel room to
+    // keep the pipe full between writes.
+    d_tcpsocket->set_option(
+        boost::asio::socket_base::send_buffer_size(TCPSINK_THROUGHPUT_SNDBUF),
+        err);
+
+    int one = 1;
+    if (setsockopt(d_tcpsocket->native_handle(), IPPROTO_TCP, TCP_CORK, &one,
+                   sizeof(one)) != 0)
+      GR_LOG_WARN(d_logger, "Unable to set TCP_CORK on socket.");
+  } break;
   }
+
+  if (err) {
+    std::stringstream msg;
+    msg << "Unable to apply socket profile: " << err.message();
+    GR_LOG_WARN(d_logger, msg.str());
+  }
+}
+
+void tcp_sink_impl::push_corked() {
+  // TCP_CORK holds a trailing partial segment back for up to 200 ms, far
+  // past the coalesce deadline.  Pulling the cork sends it now, and
+  // putting it back keeps the next write going out in full segments.
+  if (d_profile != TCPSINKPROFILE_THROUGHPUT)
+    return;
+
+  int fd = d_tcpsocket->native_handle();
+  int off = 0;
+  int on = 1;
+
+  setsockopt(fd, IPPROTO_TCP, TCP_CORK, &off, sizeof(off));
+  setsockopt(fd, IPPROTO_TCP, TCP_CORK, &on, sizeof(on));
+}
+
+void tcp_sink_impl::attach_zerocopy() {
+  if (!d_zerocopy)
+    return;
+
+  // Fresh socket, fresh completion id space.
+  d_zc_sent_unconsumed = 0;
+  d_zc_completed_unconsumed = 0;
+
+  if (!d_zc.attach(d_tcpsocket->native_handle())) {
+    GR_LOG_WARN(d_logger, "SO_ZEROCOPY not supported by this kernel.  "
+                          "Falling back to copied sends.");
+  }
+}
+
+void tcp_sink_impl::disconnect_client() {
+  // Caller holds d_setlock.
+  d_connected = false;
+
+  // Anything still pinned belonged to the old connection.  Once the socket
+  // is closed the kernel won't send completions for it.
+  d_zc.detach();
+  d_zc_sent_unconsumed = 0;
+  d_zc_completed_unconsumed = 0;
+
+  if (d_tcpsocket) {
+    boost::system::error_code err;
+    d_tcpsocket->close(err);
+    delete d_tcpsocket;
+    d_tcpsocket = NULL;
+  }
+
+  // Hand the re-accept to the listener thread.  post() wakes the reactor,
+  // so nothing has to poll for this.
+  d_io_service.post(boost::bind(&tcp_sink_impl::start_accept, this));
 }
 
 /*
@@ -188,18 +336,77 @@ void tcp_sink_impl::connect(bool initial_connection) {
  */
 tcp_sink_impl::~tcp_sink_impl() { stop(); }
 
-bool tcp_sink_impl::stop() {
-  if (d_thread_running) {
-    d_stop_thread = true;
+void tcp_sink_impl::close_acceptor() {
+  // Cancels any outstanding async_accept (handler sees operation_aborted)
+  if (d_acceptor) {
+    boost::system::error_code err;
+    d_acceptor->close(err);
   }
+}
 
-  if (d_tcpsocket) {
-    d_tcpsocket->close();
-    delete d_tcpsocket;
-    d_tcpsocket = NULL;
+void tcp_sink_impl::arm_coalesce_timer(int timeoutUs) {
+  // Caller holds d_setlock.  Re-arming cancels any earlier wait.
+  d_coalesce_timer.expires_from_now(
+      boost::posix_time::microseconds(timeoutUs));
+  d_coalesce_timer.async_wait(boost::bind(&tcp_sink_impl::coalesce_timeout,
+                                          this,
+                                          boost::asio::placeholders::error));
+}
+
+void tcp_sink_impl::coalesce_timeout(const boost::system::error_code &error) {
+  // Aborted means the timer was re-armed for a newer batch or stop() is
+  // shutting down.
+  if (error == boost::asio::error::operation_aborted)
+    return;
+
+  gr::thread::scoped_lock guard(d_setlock);
+
+  // work() may have flushed (and started a new batch) while this handler
+  // was queued.
+  if (!d_connected || d_coalesce_buffer.empty())
+    return;
+
+  boost::posix_time::time_duration waited =
+      boost::posix_time::microsec_clock::universal_time() - d_coalesce_start;
+
+  if (waited.total_microseconds() < d_coalesce_timeout_us) {
+    arm_coalesce_timer(d_coalesce_timeout_us - waited.total_microseconds());
+    return;
+  }
+
+  // Upstream has gone quiet.  Send what's queued rather than holding it
+  // until the next work() call.
+  send_bytes(&d_coalesce_buffer[0], d_coalesce_buffer.size(), 0);
+  d_coalesce_buffer.clear();
+}
+
+void tcp_sink_impl::cancel_coalesce_timer() {
+  gr::thread::scoped_lock guard(d_setlock);
+
+  boost::system::error_code err;
+  d_coalesce_timer.cancel(err);
+}
+
+bool tcp_sink_impl::stop() {
+  if (d_listener_thread) {
+    // Close the acceptor and cancel the coalesce deadline on the listener
+    // thread, then drop the work guard.  Once the aborted handlers run,
+    // run() has nothing left to do and returns on its own.
+    d_io_service.post(boost::bind(&tcp_sink_impl::close_acceptor, this));
+    d_io_service.post(
+        boost::bind(&tcp_sink_impl::cancel_coalesce_timer, this));
+
+    if (d_io_work) {
+      delete d_io_work;
+      d_io_work = NULL;
+    }
+
+    d_listener_thread->join();
+
+    delete d_listener_thread;
+    d_listener_thread = NULL;
   }
 
-  d_io_service.reset();
   d_io_service.stop();
 
   if (d_acceptor) {
@@ -207,12 +414,23 @@ bool tcp_sink_impl::stop() {
     d_acceptor = NULL;
   }
 
-  if (d_listener_thread) {
-    while (d_thread_running)
-      usleep(5);
+  gr::thread::scoped_lock guard(d_setlock);
 
-    delete d_listener_thread;
-    d_listener_thread = NULL;
+  // Push out anything still sitting in the coalesce buffer.
+  if (d_connected && d_tcpsocket && !d_coalesce_buffer.empty()) {
+    boost::system::error_code err;
+    boost::asio::write(*d_tcpsocket, boost::asio::buffer(d_coalesce_buffer),
+                       err);
+    d_coalesce_buffer.clear();
+  }
+
+  d_connected = false;
+
+  if (d_tcpsocket) {
+    boost::system::error_code err;
+    d_tcpsocket->close(err);
+    delete d_tcpsocket;
+    d_tcpsocket = NULL;
   }
 
   return true;
@@ -265,23 +483,161 @@ void tcp_sink_impl::check_for_disconnect() {
   }
 }
 
-int tcp_sink_impl::work(int noutput_items,
-                        gr_vector_const_void_star &input_items,
-                        gr_vector_void_star &output_items) {
-  gr::thread::scoped_lock guard(d_setlock);
+int tcp_sink_impl::work_zerocopy(int noutput_items, const char *in) {
+  size_t noi = noutput_items * d_block_size;
+
+  d_zc_completed_unconsumed += d_zc.reap();
+
+  // Bytes [0, d_zc_sent_unconsumed) of the input were already handed to
+  // the kernel on a previous call.  Send whatever follows.
+  if (noi > d_zc_sent_unconsumed) {
+    struct iovec iov;
+    iov.iov_base = (void *)&in[d_zc_sent_unconsumed];
+    iov.iov_len = noi - d_zc_sent_unconsumed;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    ssize_t bytesWritten = d_zc.send(&msg, MSG_NOSIGNAL);
+
+    if (bytesWritten > 0) {
+      d_zc_sent_unconsumed += bytesWritten;
+      d_write_count++;
+      d_write_bytes += bytesWritten;
+      push_corked();
+    } else if (bytesWritten < 0 && errno != EINTR && errno != EAGAIN) {
+      // Whatever was in flight is gone with the connection.
+      return handle_send_error(noutput_items);
+    }
+  } else if (d_zc_completed_unconsumed < d_block_size) {
+    // Everything we were given is in flight and nothing can be released
+    // yet.  Wait for the kernel rather than spinning through work().
+    if (d_zc.wait(10))
+      d_zc_completed_unconsumed += d_zc.reap();
+  }
 
-  if (!d_connected)
-    return noutput_items;
+  int items = d_zc_completed_unconsumed / d_block_size;
+  size_t released = items * d_block_size;
 
-  const char *in = (const char *)input_items[0];
-  unsigned int noi = noutput_items * d_block_size;
+  d_zc_completed_unconsumed -= released;
+  d_zc_sent_unconsumed -= released;
+
+  return items;
+}
+
+int tcp_sink_impl::handle_send_error(int noutput_items) {
+  // Connection was reset
+  d_connected = false;
+  d_coalesce_buffer.clear();
+
+  if (d_sinkmode == TCPSINKMODE_CLIENT) {
+    GR_LOG_WARN(d_logger,
+                "Server closed the connection.  Stopping processing.");
+
+    return WORK_DONE;
+  } else {
+    GR_LOG_INFO(d_logger, "Client disconnected. Waiting for new connection.");
+
+    // start waiting for another connection
+    disconnect_client();
+  }
+
+  return noutput_items;
+}
+
+int tcp_sink_impl::work_framed(int noutput_items, const char *in) {
+  uint64_t firstItem = nitems_read(0);
+
+  get_tags_in_range(d_tags, 0, firstItem, firstItem + noutput_items);
+  serialize_frame_tags(d_tags, firstItem, d_tag_buffer);
+
+  TcpFrameHeader header;
+  header.seqnum = ++d_frame_seq;
+  header.itemSize = d_block_size;
+  header.itemCount = noutput_items;
+  header.tagBytes = d_tag_buffer.size();
+
+  if (d_frame_mode == TCPFRAMEMODE_FRAMED_TIMESTAMP) {
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    header.flags |= TCPFRAME_FLAG_TIMESTAMP;
+    header.timestampNs = (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+  }
+
+  // Header, tags and payload go out in one writev() so the frame (and its
+  // tag metadata) never needs an extra copy or a separate message.
+  struct iovec iov[3];
+  int iovcnt = 0;
+
+  iov[iovcnt].iov_base = &header;
+  iov[iovcnt].iov_len = sizeof(header);
+  iovcnt++;
+
+  if (!d_tag_buffer.empty()) {
+    iov[iovcnt].iov_base = &d_tag_buffer[0];
+    iov[iovcnt].iov_len = d_tag_buffer.size();
+    iovcnt++;
+  }
+
+  iov[iovcnt].iov_base = (void *)in;
+  iov[iovcnt].iov_len = noutput_items * d_block_size;
+  iovcnt++;
+
+  size_t frameBytes = 0;
+  for (int i = 0; i < iovcnt; i++)
+    frameBytes += iov[i].iov_len;
+
+  d_write_count++;
+  d_write_bytes += frameBytes;
+
+  struct iovec *pIov = iov;
+  int fd = d_tcpsocket->native_handle();
+
+  while (frameBytes > 0) {
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = pIov;
+    msg.msg_iovlen = iovcnt;
+
+    ssize_t bytesWritten = sendmsg(fd, &msg, MSG_NOSIGNAL);
+
+    if (bytesWritten < 0) {
+      if (errno == EINTR)
+        continue;
+
+      return handle_send_error(noutput_items);
+    }
+
+    frameBytes -= bytesWritten;
+
+    // Short write: step past whatever went out and finish the frame.
+    while (iovcnt > 0 && (size_t)bytesWritten >= pIov->iov_len) {
+      bytesWritten -= pIov->iov_len;
+      pIov++;
+      iovcnt--;
+    }
+
+    if (iovcnt > 0) {
+      pIov->iov_base = (char *)pIov->iov_base + bytesWritten;
+      pIov->iov_len -= bytesWritten;
+    }
+  }
+
+  push_corked();
+
+  return noutput_items;
+}
+
+int tcp_sink_impl::send_bytes(const char *pBuff, int bytesRemaining,
+                              int noutput_items) {
   int bytesWritten;
-  int bytesRemaining = noi;
 
   ec.clear();
 
-  char *pBuff;
-  pBuff = (char *)input_items[0];
+  d_write_count++;
+  d_write_bytes += bytesRemaining;
 
   while ((bytesRemaining > 0) && (!ec)) {
     bytesWritten = boost::asio::write(
@@ -292,27 +648,65 @@ int tcp_sink_impl::work(int noutput_items,
 
     if (ec == boost::asio::error::connection_reset ||
         ec == boost::asio::error::broken_pipe) {
+      return handle_send_error(noutput_items);
+    }
+  }
+
+  push_corked();
+
+  return noutput_items;
+}
 
-      // Connection was reset
-      d_connected = false;
-      bytesRemaining = 0;
+int tcp_sink_impl::work(int noutput_items,
+                        gr_vector_const_void_star &input_items,
+                        gr_vector_void_star &output_items) {
+  gr::thread::scoped_lock guard(d_setlock);
 
-      if (d_sinkmode == TCPSINKMODE_CLIENT) {
-        GR_LOG_WARN(d_logger,
-                    "Server closed the connection.  Stopping processing.");
+  // A client only loses its connection on a send error, which may have
+  // come from a deadline flush rather than from work() itself.
+  if (!d_connected)
+    return (d_sinkmode == TCPSINKMODE_CLIENT) ? WORK_DONE : noutput_items;
 
-        return WORK_DONE;
-      } else {
-        GR_LOG_INFO(d_logger,
-                    "Client disconnected. Waiting for new connection.");
+  if (d_zerocopy)
+    return work_zerocopy(noutput_items, (const char *)input_items[0]);
 
-        // start waiting for another connection
-        d_start_new_listener = true;
-      }
-    }
+  if (d_frame_mode != TCPFRAMEMODE_NONE)
+    return work_framed(noutput_items, (const char *)input_items[0]);
+
+  const char *in = (const char *)input_items[0];
+  unsigned int noi = noutput_items * d_block_size;
+
+  if (d_coalesce_size == 0)
+    return send_bytes(in, noi, noutput_items);
+
+  // Throughput profile: hold small work() calls until we have a
+  // worthwhile write or the oldest queued byte hits the deadline.  The
+  // deadline is checked here and by the timer, which covers upstream
+  // going quiet with data still queued.
+  if (d_coalesce_buffer.empty()) {
+    if (noi >= d_coalesce_size)
+      return send_bytes(in, noi, noutput_items); // Already big enough
+
+    d_coalesce_start = boost::posix_time::microsec_clock::universal_time();
+    arm_coalesce_timer(d_coalesce_timeout_us);
   }
 
-  return noutput_items;
+  d_coalesce_buffer.insert(d_coalesce_buffer.end(), in, in + noi);
+
+  if (d_coalesce_buffer.size() < d_coalesce_size) {
+    boost::posix_time::time_duration waited =
+        boost::posix_time::microsec_clock::universal_time() -
+        d_coalesce_start;
+
+    if (waited.total_microseconds() < d_coalesce_timeout_us)
+      return noutput_items;
+  }
+
+  int retVal = send_bytes(&d_coalesce_buffer[0], d_coalesce_buffer.size(),
+                          noutput_items);
+  d_coalesce_buffer.clear();
+
+  return retVal;
 }
 } /* namespace grnet */
 } /* namespace gr */
@@ -23,9 +23,16 @@
 
 #include <boost/asio.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/thread/thread.hpp>
 #include <grnet/tcp_sink.h>
 
+#include "tcp_frame.h"
+#include "zerocopy_tracker.h"
+
+// Socket send buffer requested by the throughput profile
+#define TCPSINK_THROUGHPUT_SNDBUF (4 * 1024 * 1024)
+
 namespace gr {
 namespace grnet {
 
@@ -39,34 +46,80 @@ protected:
 
   boost::system::error_code ec;
 
+  // In server mode, or with coalescing on, the io_service lives for the
+  // life of the block.  The listener thread sits in io_service::run()
+  // (blocked in the reactor, no polling) and the work guard keeps run()
+  // from returning while no accept or deadline is outstanding.
   boost::asio::io_service d_io_service;
+  boost::asio::io_service::work *d_io_work = NULL;
   boost::asio::ip::tcp::endpoint d_endpoint;
   boost::asio::ip::tcp::socket *d_tcpsocket = NULL;
   boost::asio::ip::tcp::acceptor *d_acceptor = NULL;
 
   boost::thread *d_listener_thread;
-  bool d_thread_running;
-  bool d_stop_thread;
-  bool d_start_new_listener;
-  bool d_initial_connection;
 
   std::string d_host;
   int d_port;
 
   bool d_connected;
 
+  // MSG_ZEROCOPY state.  Sent bytes stay in the scheduler's input buffer
+  // (unconsumed) until the kernel completes them.
+  bool d_zerocopy;
+  zerocopy_tracker d_zc;
+  size_t d_zc_sent_unconsumed;
+  size_t d_zc_completed_unconsumed;
+
+  // Socket profile and write coalescing
+  int d_profile;
+  size_t d_coalesce_size;
+  int d_coalesce_timeout_us;
+  std::vector<char> d_coalesce_buffer;
+  boost::posix_time::ptime d_coalesce_start;
+  boost::asio::deadline_timer d_coalesce_timer;
+
+  uint64_t d_write_count;
+  uint64_t d_write_bytes;
+
+  // Framed mode
+  int d_frame_mode;
+  uint64_t d_frame_seq;
+  std::vector<gr::tag_t> d_tags;
+  std::vector<char> d_tag_buffer;
+
   virtual void check_for_disconnect();
-  virtual void connect(bool initial_connection);
+  void apply_profile();
+  void push_corked();
+  int send_bytes(const char *pBuff, int bytesRemaining, int noutput_items);
+  int handle_send_error(int noutput_items);
+  int work_framed(int noutput_items, const char *in);
+  void attach_zerocopy();
+  int work_zerocopy(int noutput_items, const char *in);
+  virtual void start_accept();
+  virtual void disconnect_client();
+  void close_acceptor();
+  void arm_coalesce_timer(int timeoutUs);
+  void coalesce_timeout(const boost::system::error_code &error);
+  void cancel_coalesce_timer();
 
   virtual void run_listener();
 
 public:
   tcp_sink_impl(size_t itemsize, size_t vecLen, const std::string &host,
-                int port, int sinkMode = TCPSINKMODE_CLIENT);
+                int port, int sinkMode = TCPSINKMODE_CLIENT,
+                bool zerocopy = false, int profile = TCPSINKPROFILE_DEFAULT,
+                int coalesceSize = 65536, int coalesceTimeoutUs = 2000,
+                int frameMode = TCPFRAMEMODE_NONE);
   ~tcp_sink_impl();
 
   virtual bool stop();
 
+  uint64_t zerocopy_copied_sends() const { return d_zc.copied_sends(); }
+  uint64_t write_count() const { return d_write_count; }
+  double avg_write_size() const {
+    return d_write_count ? (double)d_write_bytes / (double)d_write_count : 0.0;
+  }
+
   void accept_handler(boost::asio::ip::tcp::socket *new_connection,
                       const boost::system::error_code &error);
 
@@ -26,15 +26,18 @@
 #include <boost/array.hpp>
 #include <boost/format.hpp>
 #include <gnuradio/io_signature.h>
+#include <sstream>
 
 namespace gr {
 namespace grnet {
 
 udp_sink::sptr udp_sink::make(size_t itemsize, size_t vecLen,
                               const std::string &host, int port, int headerType,
-                              int payloadsize, bool send_eof) {
-  return gnuradio::get_initial_sptr(new udp_sink_impl(
-      itemsize, vecLen, host, port, headerType, payloadsize, send_eof));
+                              int payloadsize, bool send_eof,
+                              bool zerocopy) {
+  return gnuradio::get_initial_sptr(
+      new udp_sink_impl(itemsize, vecLen, host, port, headerType, payloadsize,
+                        send_eof, zerocopy));
 }
 
 /*
@@ -42,13 +45,14 @@ udp_sink::sptr udp_sink::make(size_t itemsize, size_t vecLen,
  */
 udp_sink_impl::udp_sink_impl(size_t itemsize, size_t vecLen,
                              const std::string &host, int port, int headerType,
-                             int payloadsize, bool send_eof)
+                             int payloadsize, bool send_eof, bool zerocopy)
     : gr::sync_block("udp_sink",
                      gr::io_signature::make(1, 1, itemsize * vecLen),
                      gr::io_signature::make(0, 0, 0)),
       d_itemsize(itemsize), d_veclen(vecLen), d_header_type(headerType),
       d_seq_num(0), d_header_size(0), d_payloadsize(payloadsize),
-      b_send_eof(send_eof) {
+      b_send_eof(send_eof), d_zerocopy(zerocopy), d_zc_sent_unconsumed(0),
+      d_zc_completed_unconsumed(0), d_zc_headers(NULL), d_zc_next_header(0) {
   // Lets set up the max payload size for the UDP packet based on the requested
   // payload size. Some important notes:  For a standard IP/UDP packet, say
   // crossing the Internet with a standard MTU, 1472 is the max UDP payload
@@ -148,6 +152,15 @@ udp_sink_impl::udp_sink_impl(size_t itemsize, size_t vecLen,
     d_udpsocket->open(boost::asio::ip::udp::v4());
   }
 
+  if (d_zerocopy) {
+    d_zc_headers = new char[UDP_ZEROCOPY_HEADER_SLOTS * sizeof(d_tmpheaderbuff)];
+
+    if (!d_zc.attach(d_udpsocket->native_handle())) {
+      GR_LOG_WARN(d_logger, "SO_ZEROCOPY not supported by this kernel.  "
+                            "Falling back to copied sends.");
+    }
+  }
+
   int out_multiple = (d_payloadsize - d_header_size) / d_block_size;
 
   if (out_multiple == 1)
@@ -190,6 +203,13 @@ bool udp_sink_impl::stop() {
       d_localqueue = NULL;
   }
 
+  d_zc.detach();
+
+  if (d_zc_headers) {
+    delete[] d_zc_headers;
+    d_zc_headers = NULL;
+  }
+
   return true;
 }
 
@@ -276,11 +296,100 @@ int udp_sink_impl::work_test(int noutput_items,
 	  return itemsreturned;
 }
 
+int udp_sink_impl::work_zerocopy(int noutput_items, const char *in) {
+  size_t noi = noutput_items * d_block_size;
+
+  d_zc_completed_unconsumed += d_zc.reap();
+
+  // Packets are cut straight out of the input buffer.  Bytes
+  // [0, d_zc_sent_unconsumed) were already handed to the kernel on a
+  // previous call.  A trailing partial packet is left in the input buffer
+  // until more data shows up.
+  bool sent_any = false;
+
+  while ((noi > d_zc_sent_unconsumed) &&
+         (noi - d_zc_sent_unconsumed >= (size_t)d_precomp_datasize) &&
+         (d_zc.sends_in_flight() < UDP_ZEROCOPY_HEADER_SLOTS)) {
+    struct iovec iov[2];
+    int iovcnt = 0;
+
+    // The sequence number and header slot are only used up once the send
+    // is accepted, so a full socket doesn't skip a sequence number or
+    // leave a slot marked used with nothing in flight.
+    uint64_t prevSeqNum = d_seq_num;
+
+    if (d_header_type != HEADERTYPE_NONE) {
+      build_header();
+
+      // The header has to stay put until the kernel is done with it too,
+      // so each in-flight send gets its own slot.
+      char *pHeader =
+          &d_zc_headers[d_zc_next_header * sizeof(d_tmpheaderbuff)];
+      memcpy(pHeader, d_tmpheaderbuff, d_header_size);
+
+      iov[iovcnt].iov_base = pHeader;
+      iov[iovcnt].iov_len = d_header_size;
+      iovcnt++;
+    }
+
+    iov[iovcnt].iov_base = (void *)&in[d_zc_sent_unconsumed];
+    iov[iovcnt].iov_len = d_precomp_datasize;
+    iovcnt++;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = d_endpoint.data();
+    msg.msg_namelen = d_endpoint.size();
+    msg.msg_iov = iov;
+    msg.msg_iovlen = iovcnt;
+
+    if (d_zc.send(&msg, 0, d_precomp_datasize) < 0) {
+      if (errno == EAGAIN || errno == ENOBUFS) {
+        // Socket buffer full.  Try again on the next call.
+        d_seq_num = prevSeqNum;
+        break;
+      }
+
+      std::stringstream msg_stream;
+      msg_stream << "Send error: " << strerror(errno);
+      GR_LOG_ERROR(d_logger, msg_stream.str());
+
+      // Drop the packet, same as a failed send on the copy path.  The
+      // kernel holds no reference to the header slot, so it stays free.
+      d_zc.skip(d_precomp_datasize);
+    } else if (d_header_type != HEADERTYPE_NONE) {
+      d_zc_next_header = (d_zc_next_header + 1) % UDP_ZEROCOPY_HEADER_SLOTS;
+    }
+
+    d_zc_sent_unconsumed += d_precomp_datasize;
+    sent_any = true;
+  }
+
+  if (!sent_any && d_zc_completed_unconsumed < d_block_size &&
+      d_zc.bytes_in_flight() > 0) {
+    // Nothing new to send and nothing released yet.  Wait for the kernel
+    // rather than spinning through work().
+    if (d_zc.wait(10))
+      d_zc_completed_unconsumed += d_zc.reap();
+  }
+
+  int items = d_zc_completed_unconsumed / d_block_size;
+  size_t released = items * d_block_size;
+
+  d_zc_completed_unconsumed -= released;
+  d_zc_sent_unconsumed -= released;
+
+  return items;
+}
+
 int udp_sink_impl::work(int noutput_items,
                         gr_vector_const_void_star &input_items,
                         gr_vector_void_star &output_items) {
   gr::thread::scoped_lock guard(d_setlock);
 
+  if (d_zerocopy)
+    return work_zerocopy(noutput_items, (const char *)input_items[0]);
+
   long numBytesToTransmit = noutput_items * d_block_size;
   const char *in = (const char *)input_items[0];
 
@@ -27,6 +27,11 @@
 #include <boost/circular_buffer.hpp>
 
 #include "packet_headers.h"
+#include "zerocopy_tracker.h"
+
+// Number of packet headers that can be in flight with MSG_ZEROCOPY.  Each
+// in-flight send references its own header slot until it completes.
+#define UDP_ZEROCOPY_HEADER_SLOTS 1024
 
 namespace gr {
 namespace grnet {
@@ -63,17 +68,31 @@ protected:
 
   boost::mutex d_mutex;
 
+  // MSG_ZEROCOPY state.  Sent bytes stay in the scheduler's input buffer
+  // (unconsumed) until the kernel completes them.
+  bool d_zerocopy;
+  zerocopy_tracker d_zc;
+  size_t d_zc_sent_unconsumed;
+  size_t d_zc_completed_unconsumed;
+  char *d_zc_headers;
+  int d_zc_next_header;
+
   virtual void
   build_header(); // returns header size.  Header is stored in tmpHeaderBuff
 
+  int work_zerocopy(int noutput_items, const char *in);
+
 public:
   udp_sink_impl(size_t itemsize, size_t vecLen, const std::string &host,
                 int port, int headerType = HEADERTYPE_NONE,
-                int payloadsize = 1472, bool send_eof = true);
+                int payloadsize = 1472, bool send_eof = true,
+                bool zerocopy = false);
   ~udp_sink_impl();
 
   bool stop();
 
+  uint64_t zerocopy_copied_sends() const { return d_zc.copied_sends(); }
+
   // Where all the action really happens
   int work_test(int noutput_items, gr_vector_const_void_star &input_items,
                 gr_vector_void_star &output_items);
@@ -0,0 +1,190 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "zerocopy_tracker.h"
+
+#include <errno.h>
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+
+namespace gr {
+namespace grnet {
+
+zerocopy_tracker::zerocopy_tracker()
+    : d_fd(-1), d_enabled(false), d_next_id(0), d_bytes_in_flight(0),
+      d_copied_sends(0) {}
+
+bool zerocopy_tracker::attach(int fd) {
+  detach();
+
+  d_fd = fd;
+
+  int one = 1;
+  if (setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0)
+    d_enabled = true;
+  else
+    d_enabled = false;
+
+  return d_enabled;
+}
+
+void zerocopy_tracker::detach() {
+  d_fd = -1;
+  d_enabled = false;
+  d_next_id = 0;
+  d_bytes_in_flight = 0;
+  d_pending.clear();
+}
+
+void zerocopy_tracker::skip(size_t bytes) {
+  pending_send ps;
+  ps.id = 0;
+  ps.bytes = bytes;
+  ps.zerocopy = false;
+  ps.done = true;
+  d_pending.push_back(ps);
+  d_bytes_in_flight += bytes;
+}
+
+ssize_t zerocopy_tracker::send(struct msghdr *msg, int flags,
+                               ssize_t tracked_bytes) {
+  ssize_t bytes_sent = -1;
+
+  if (d_enabled) {
+    bytes_sent = sendmsg(d_fd, msg, flags | MSG_ZEROCOPY);
+
+    if (bytes_sent >= 0) {
+      pending_send ps;
+      ps.id = d_next_id++;
+      ps.bytes = (tracked_bytes >= 0) ? tracked_bytes : bytes_sent;
+      ps.zerocopy = true;
+      ps.done = false;
+      d_pending.push_back(ps);
+      d_bytes_in_flight += ps.bytes;
+      return bytes_sent;
+    }
+
+    // ENOBUFS means we've hit the per-socket optmem limit on pinned
+    // pages.  Anything else is a real error for the caller.
+    if (errno != ENOBUFS)
+      return bytes_sent;
+  }
+
+  bytes_sent = sendmsg(d_fd, msg, flags);
+
+  if (bytes_sent >= 0) {
+    d_copied_sends++;
+
+    // The data was copied so it can be released as soon as everything
+    // queued ahead of it has completed.
+    skip((tracked_bytes >= 0) ? tracked_bytes : bytes_sent);
+  }
+
+  return bytes_sent;
+}
+
+void zerocopy_tracker::complete_range(uint32_t lo, uint32_t hi, bool copied) {
+  uint32_t span = hi - lo;
+
+  for (std::deque<pending_send>::iterator it = d_pending.begin();
+       it != d_pending.end(); ++it) {
+    // Unsigned subtraction handles the 32-bit id wrapping
+    if (it->zerocopy && !it->done && (uint32_t)(it->id - lo) <= span)
+      it->done = true;
+  }
+
+  if (copied)
+    d_copied_sends += (uint64_t)span + 1;
+}
+
+size_t zerocopy_tracker::reap() {
+  if (d_fd >= 0 && d_enabled) {
+    char control[128];
+
+    while (true) {
+      struct msghdr msg;
+      memset(&msg, 0, sizeof(msg));
+      msg.msg_control = control;
+      msg.msg_controllen = sizeof(control);
+
+      if (recvmsg(d_fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        break; // EAGAIN: queue drained
+
+      for (struct cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm != NULL;
+           cm = CMSG_NXTHDR(&msg, cm)) {
+        if (!((cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) ||
+              (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR)))
+          continue;
+
+        struct sock_extended_err *serr =
+            (struct sock_extended_err *)CMSG_DATA(cm);
+
+        if (serr->ee_errno != 0 || serr->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+          continue;
+
+        complete_range(serr->ee_info, serr->ee_data,
+                       (serr->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0);
+      }
+    }
+  }
+
+  // Completions can be reported out of order (UDP), but the scheduler
+  // buffer can only be released from the front.
+  size_t released = 0;
+
+  while (!d_pending.empty() && d_pending.front().done) {
+    released += d_pending.front().bytes;
+    d_pending.pop_front();
+  }
+
+  d_bytes_in_flight -= released;
+
+  return released;
+}
+
+bool zerocopy_tracker::wait(int timeout_ms) {
+  if (d_fd < 0)
+    return false;
+
+  // The error queue signals as POLLERR, which poll() always reports.
+  struct pollfd pfd;
+  pfd.fd = d_fd;
+  pfd.events = 0;
+  pfd.revents = 0;
+
+  return (poll(&pfd, 1, timeout_ms) > 0) && (pfd.revents & POLLERR);
+}
+
+} // namespace grnet
+} // namespace gr
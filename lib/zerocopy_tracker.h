@@ -0,0 +1,121 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2026 ghostop14.
+ *
+ * This is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3, or (at your option)
+ * any later version.
+ *
+ * This software is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef INCLUDED_GRNET_ZEROCOPY_TRACKER_H
+#define INCLUDED_GRNET_ZEROCOPY_TRACKER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <deque>
+
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+
+namespace gr {
+namespace grnet {
+
+/*
+ * Bookkeeping for MSG_ZEROCOPY sends.
+ *
+ * With MSG_ZEROCOPY the kernel pins the user pages instead of copying them
+ * into the socket buffer, so the memory handed to send() can't be reused
+ * until the kernel posts a completion on the socket error queue.  For the
+ * sinks that memory is the scheduler's input buffer, so bytes may only be
+ * consume()d once their completion has been reaped.
+ *
+ * Every successful zerocopy send is assigned the next 32-bit id by the
+ * kernel (per socket, starting at 0) and completions arrive as inclusive
+ * id ranges.  This class mirrors that counter, keeps the byte count of each
+ * send in order, and reports how many leading bytes are released.
+ *
+ * Sends that had to be copied (no SO_ZEROCOPY support, ENOBUFS on the
+ * optmem limit, or the kernel reporting it copied anyway, e.g. over
+ * loopback) are counted in copied_sends().
+ */
+class zerocopy_tracker {
+private:
+  struct pending_send {
+    uint32_t id;
+    size_t bytes;
+    bool zerocopy;
+    bool done;
+  };
+
+  int d_fd;
+  bool d_enabled;
+  uint32_t d_next_id;
+  size_t d_bytes_in_flight;
+  uint64_t d_copied_sends;
+
+  std::deque<pending_send> d_pending;
+
+  void complete_range(uint32_t lo, uint32_t hi, bool copied);
+
+public:
+  zerocopy_tracker();
+
+  // Set SO_ZEROCOPY on the socket and reset all tracking state.  Returns
+  // false if the kernel doesn't support it, in which case send() silently
+  // falls back to copying.
+  bool attach(int fd);
+
+  // Forget any outstanding sends (socket closed / client dropped).
+  void detach();
+
+  bool enabled() const { return d_enabled; }
+  int fd() const { return d_fd; }
+
+  // Send a message, with MSG_ZEROCOPY when enabled.  Falls back to a
+  // regular (copying) send on ENOBUFS.  Returns bytes sent or -1 with errno
+  // set, same as sendmsg().  tracked_bytes is what reap() will later
+  // release for this send; by default it's the number of bytes sent, but
+  // datagram senders pass just the payload so headers aren't counted
+  // against the input buffer.
+  ssize_t send(struct msghdr *msg, int flags = 0, ssize_t tracked_bytes = -1);
+
+  // Queue bytes that were dropped rather than sent, so they are released
+  // in order with everything around them.
+  void skip(size_t bytes);
+
+  // Pull all available completions off the error queue.  Returns the number
+  // of leading bytes that are now safe to release.
+  size_t reap();
+
+  // Block until the error queue has something on it or timeout_ms expires.
+  bool wait(int timeout_ms);
+
+  size_t bytes_in_flight() const { return d_bytes_in_flight; }
+  size_t sends_in_flight() const { return d_pending.size(); }
+  uint64_t copied_sends() const { return d_copied_sends; }
+  void count_copied_send() { d_copied_sends++; }
+};
+
+} // namespace grnet
+} // namespace gr
+
+#endif /* INCLUDED_GRNET_ZEROCOPY_TRACKER_H */
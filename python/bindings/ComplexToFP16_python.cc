@@ -0,0 +1,60 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(ComplexToFP16.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(f0c79f10fdd3383361b9a1ea3ff5e9b3)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/ComplexToFP16.h>
+// pydoc.h is automatically generated in the build directory
+#include <ComplexToFP16_pydoc.h>
+
+void bind_ComplexToFP16(py::module& m)
+{
+
+    using ComplexToFP16    = ::gr::grnet::ComplexToFP16;
+
+
+    py::class_<ComplexToFP16, gr::sync_interpolator,
+        std::shared_ptr<ComplexToFP16>>(m, "ComplexToFP16", D(ComplexToFP16))
+
+        .def(py::init(&ComplexToFP16::make),
+           py::arg("bfloat16") = false,
+           D(ComplexToFP16,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(ComplexToInt16Bytes.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(38c2e1df1399033869bd45818b46488d)                     */
+/* BINDTOOL_HEADER_FILE_HASH(b00bd5c7a66049be055e1111949981b5)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -37,6 +37,7 @@ void bind_ComplexToInt16Bytes(py::module& m)
         std::shared_ptr<ComplexToInt16Bytes>>(m, "ComplexToInt16Bytes", D(ComplexToInt16Bytes))
 
         .def(py::init(&ComplexToInt16Bytes::make),
+           py::arg("bigEndian") = false,
            D(ComplexToInt16Bytes,make)
         )
         
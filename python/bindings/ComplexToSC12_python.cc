@@ -0,0 +1,65 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(ComplexToSC12.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(2bb88dcb198b2a718217bc5441a3a1c6)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/ComplexToSC12.h>
+// pydoc.h is automatically generated in the build directory
+#include <ComplexToSC12_pydoc.h>
+
+void bind_ComplexToSC12(py::module& m)
+{
+
+    using ComplexToSC12    = ::gr::grnet::ComplexToSC12;
+
+
+    py::class_<ComplexToSC12, gr::sync_interpolator,
+        std::shared_ptr<ComplexToSC12>>(m, "ComplexToSC12", D(ComplexToSC12))
+
+        .def(py::init(&ComplexToSC12::make),
+           py::arg("scale") = 2047.0,
+            D(ComplexToSC12,make)
+        )
+
+
+        .def("saturated",&ComplexToSC12::saturated,       
+            D(ComplexToSC12,saturated)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(ComplexToSC16.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(a9c94b48caf6b317e7cc9974d81a8fe0)                     */
+/* BINDTOOL_HEADER_FILE_HASH(77f7d23f025c907c7f6a81e6219bc2a2)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -37,8 +37,18 @@ void bind_ComplexToSC16(py::module& m)
         std::shared_ptr<ComplexToSC16>>(m, "ComplexToSC16", D(ComplexToSC16))
 
         .def(py::init(&ComplexToSC16::make),
+           py::arg("bigEndian") = false,
+           py::arg("scale") = 32767.0,
+           py::arg("offset") = gr_complex(0, 0),
+           py::arg("nthreads") = 1,
            D(ComplexToSC16,make)
         )
+
+
+        .def("saturated",&ComplexToSC16::saturated,       
+            D(ComplexToSC16,saturated)
+        )
+
         
 
 
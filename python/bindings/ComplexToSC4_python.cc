@@ -0,0 +1,65 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(ComplexToSC4.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(7d3d656889f25e594802244b98743123)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/ComplexToSC4.h>
+// pydoc.h is automatically generated in the build directory
+#include <ComplexToSC4_pydoc.h>
+
+void bind_ComplexToSC4(py::module& m)
+{
+
+    using ComplexToSC4    = ::gr::grnet::ComplexToSC4;
+
+
+    py::class_<ComplexToSC4, gr::sync_block,
+        std::shared_ptr<ComplexToSC4>>(m, "ComplexToSC4", D(ComplexToSC4))
+
+        .def(py::init(&ComplexToSC4::make),
+           py::arg("scale") = 7.0,
+            D(ComplexToSC4,make)
+        )
+
+
+        .def("saturated",&ComplexToSC4::saturated,       
+            D(ComplexToSC4,saturated)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
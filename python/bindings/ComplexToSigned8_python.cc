@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(ComplexToSigned8.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(82ccdebc71e6d262369ae6f665982c65)                     */
+/* BINDTOOL_HEADER_FILE_HASH(685ff808c280901fdf2aa75ed23c568f)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -37,8 +37,16 @@ void bind_ComplexToSigned8(py::module& m)
         std::shared_ptr<ComplexToSigned8>>(m, "ComplexToSigned8", D(ComplexToSigned8))
 
         .def(py::init(&ComplexToSigned8::make),
+           py::arg("scale") = 127.0,
+           py::arg("offset") = gr_complex(0, 0),
            D(ComplexToSigned8,make)
         )
+
+
+        .def("saturated",&ComplexToSigned8::saturated,       
+            D(ComplexToSigned8,saturated)
+        )
+
         
 
 
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(ComplexToUnsigned8.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(92fdb628126891f933df683cdcb4f676)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/ComplexToUnsigned8.h>
+// pydoc.h is automatically generated in the build directory
+#include <ComplexToUnsigned8_pydoc.h>
+
+void bind_ComplexToUnsigned8(py::module& m)
+{
+
+    using ComplexToUnsigned8    = ::gr::grnet::ComplexToUnsigned8;
+
+
+    py::class_<ComplexToUnsigned8, gr::sync_interpolator,
+        std::shared_ptr<ComplexToUnsigned8>>(m, "ComplexToUnsigned8", D(ComplexToUnsigned8))
+
+        .def(py::init(&ComplexToUnsigned8::make),
+           D(ComplexToUnsigned8,make)
+        )
+
+
+        .def("saturated",&ComplexToUnsigned8::saturated,       
+            D(ComplexToUnsigned8,saturated)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(FP16ToComplex.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(a7c8f374ad5a9c09d3352923a0f8cffa)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/FP16ToComplex.h>
+// pydoc.h is automatically generated in the build directory
+#include <FP16ToComplex_pydoc.h>
+
+void bind_FP16ToComplex(py::module& m)
+{
+
+    using FP16ToComplex    = ::gr::grnet::FP16ToComplex;
+
+
+    py::class_<FP16ToComplex, gr::sync_decimator,
+        std::shared_ptr<FP16ToComplex>>(m, "FP16ToComplex", D(FP16ToComplex))
+
+        .def(py::init(&FP16ToComplex::make),
+           py::arg("bfloat16") = false,
+           py::arg("nontemporalThreshold") = 0,
+           D(FP16ToComplex,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(Int16BytesToComplex.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(a793abd7cb1cd2262afc492600d1d7b9)                     */
+/* BINDTOOL_HEADER_FILE_HASH(f51dcf659356b42ba662f82c69ea63cb)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -37,6 +37,8 @@ void bind_Int16BytesToComplex(py::module& m)
         std::shared_ptr<Int16BytesToComplex>>(m, "Int16BytesToComplex", D(Int16BytesToComplex))
 
         .def(py::init(&Int16BytesToComplex::make),
+           py::arg("bigEndian") = false,
+           py::arg("nontemporalThreshold") = 0,
            D(Int16BytesToComplex,make)
         )
         
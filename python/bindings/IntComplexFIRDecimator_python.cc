@@ -0,0 +1,62 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(IntComplexFIRDecimator.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(a4fb187da9e4af21ff1ad2d10f64a662)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/IntComplexFIRDecimator.h>
+// pydoc.h is automatically generated in the build directory
+#include <IntComplexFIRDecimator_pydoc.h>
+
+void bind_IntComplexFIRDecimator(py::module& m)
+{
+
+    using IntComplexFIRDecimator    = ::gr::grnet::IntComplexFIRDecimator;
+
+
+    py::class_<IntComplexFIRDecimator, gr::sync_decimator,
+        std::shared_ptr<IntComplexFIRDecimator>>(m, "IntComplexFIRDecimator", D(IntComplexFIRDecimator))
+
+        .def(py::init(&IntComplexFIRDecimator::make),
+           py::arg("itemsize"),
+           py::arg("decimation"),
+           py::arg("taps"),
+           D(IntComplexFIRDecimator,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(PCAPUDPSink.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(c1f3a08a043efd02dd4cb7c1da1155a7)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/PCAPUDPSink.h>
+// pydoc.h is automatically generated in the build directory
+#include <PCAPUDPSink_pydoc.h>
+
+void bind_PCAPUDPSink(py::module& m)
+{
+
+    using PCAPUDPSink    = ::gr::grnet::PCAPUDPSink;
+
+
+    py::class_<PCAPUDPSink, gr::sync_block, gr::block, gr::basic_block,
+        std::shared_ptr<PCAPUDPSink>>(m, "PCAPUDPSink", D(PCAPUDPSink))
+
+        .def(py::init(&PCAPUDPSink::make),
+           py::arg("itemsize"),
+           py::arg("vecLen"),
+           py::arg("filename"),
+           py::arg("port"),
+           py::arg("headerType"),
+           py::arg("payloadsize"),
+           py::arg("sampleRate"),
+           py::arg("useRxTime") = true,
+           py::arg("directIO") = false,
+           D(PCAPUDPSink,make)
+        )
+
+
+        .def("packets_written",&PCAPUDPSink::packets_written,       
+            D(PCAPUDPSink,packets_written)
+        )
+
+
+        .def("bytes_written",&PCAPUDPSink::bytes_written,       
+            D(PCAPUDPSink,bytes_written)
+        )
+
+
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
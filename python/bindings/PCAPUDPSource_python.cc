@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(PCAPUDPSource.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(6776eafd35ae4347ea7a461d42c569a7)                     */
+/* BINDTOOL_HEADER_FILE_HASH(e722ffe5537b7e428d765e5bf262f406)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -33,7 +33,7 @@ void bind_PCAPUDPSource(py::module& m)
     using PCAPUDPSource    = ::gr::grnet::PCAPUDPSource;
 
 
-    py::class_<PCAPUDPSource, gr::sync_block, gr::block, gr::basic_block,
+    py::class_<PCAPUDPSource, gr::block, gr::basic_block,
         std::shared_ptr<PCAPUDPSource>>(m, "PCAPUDPSource", D(PCAPUDPSource))
 
         .def(py::init(&PCAPUDPSource::make),
@@ -44,8 +44,52 @@ void bind_PCAPUDPSource(py::module& m)
            py::arg("notifyMissed"),
            py::arg("filename"),
            py::arg("repeat"),
+           py::arg("rate") = 1.0,
+           py::arg("tagCaptureTime") = false,
+           py::arg("startTime") = 0.0,
+           py::arg("duration") = 0.0,
+           py::arg("additionalPorts") = std::vector<int>(),
+           py::arg("preloadMB") = 0,
            D(PCAPUDPSource,make)
         )
+
+
+        .def("pacing_error_mean_us",&PCAPUDPSource::pacing_error_mean_us,       
+            D(PCAPUDPSource,pacing_error_mean_us)
+        )
+
+
+        .def("pacing_error_max_us",&PCAPUDPSource::pacing_error_max_us,       
+            D(PCAPUDPSource,pacing_error_max_us)
+        )
+
+
+        .def("packets_paced",&PCAPUDPSource::packets_paced,       
+            D(PCAPUDPSource,packets_paced)
+        )
+
+
+        .def("datagrams_reassembled",&PCAPUDPSource::datagrams_reassembled,       
+            D(PCAPUDPSource,datagrams_reassembled)
+        )
+
+
+        .def("datagrams_incomplete",&PCAPUDPSource::datagrams_incomplete,       
+            D(PCAPUDPSource,datagrams_incomplete)
+        )
+
+
+        .def_static("build_index",&PCAPUDPSource::build_index,
+            py::arg("filename"),
+            py::arg("interval") = 0.1,
+            D(PCAPUDPSource,build_index)
+        )
+
+
+
+
+
+
         
 
 
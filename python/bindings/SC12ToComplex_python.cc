@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(SC12ToComplex.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(ffc6d4880e6683c25180236526a0f7f6)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/SC12ToComplex.h>
+// pydoc.h is automatically generated in the build directory
+#include <SC12ToComplex_pydoc.h>
+
+void bind_SC12ToComplex(py::module& m)
+{
+
+    using SC12ToComplex    = ::gr::grnet::SC12ToComplex;
+
+
+    py::class_<SC12ToComplex, gr::sync_decimator,
+        std::shared_ptr<SC12ToComplex>>(m, "SC12ToComplex", D(SC12ToComplex))
+
+        .def(py::init(&SC12ToComplex::make),
+           py::arg("scale") = 2047.0,
+           py::arg("nontemporalThreshold") = 0,
+           D(SC12ToComplex,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
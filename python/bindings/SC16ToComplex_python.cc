@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(SC16ToComplex.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(8ecbca0ec74bc5a1fc7f3ab9504387cf)                     */
+/* BINDTOOL_HEADER_FILE_HASH(f19b9aac187c83b6167443e0023d5321)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -37,6 +37,9 @@ void bind_SC16ToComplex(py::module& m)
         std::shared_ptr<SC16ToComplex>>(m, "SC16ToComplex", D(SC16ToComplex))
 
         .def(py::init(&SC16ToComplex::make),
+           py::arg("bigEndian") = false,
+           py::arg("nthreads") = 1,
+           py::arg("nontemporalThreshold") = 0,
            D(SC16ToComplex,make)
         )
         
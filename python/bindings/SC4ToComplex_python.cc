@@ -0,0 +1,61 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(SC4ToComplex.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(a0ba491701a1128fe7917abb857c967b)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/SC4ToComplex.h>
+// pydoc.h is automatically generated in the build directory
+#include <SC4ToComplex_pydoc.h>
+
+void bind_SC4ToComplex(py::module& m)
+{
+
+    using SC4ToComplex    = ::gr::grnet::SC4ToComplex;
+
+
+    py::class_<SC4ToComplex, gr::sync_block,
+        std::shared_ptr<SC4ToComplex>>(m, "SC4ToComplex", D(SC4ToComplex))
+
+        .def(py::init(&SC4ToComplex::make),
+           py::arg("scale") = 7.0,
+           py::arg("nontemporalThreshold") = 0,
+           D(SC4ToComplex,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(Signed8ToComplex.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(9bccfd60dae728b289eb1bba70c1f664)                     */
+/* BINDTOOL_HEADER_FILE_HASH(011e085f3375f2910211810942cd3edb)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -37,6 +37,7 @@ void bind_Signed8ToComplex(py::module& m)
         std::shared_ptr<Signed8ToComplex>>(m, "Signed8ToComplex", D(Signed8ToComplex))
 
         .def(py::init(&Signed8ToComplex::make),
+           py::arg("nontemporalThreshold") = 0,
            D(Signed8ToComplex,make)
         )
         
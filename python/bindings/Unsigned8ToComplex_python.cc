@@ -0,0 +1,60 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(Unsigned8ToComplex.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(7777ded246762222ad1a8cbbce0eac19)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/Unsigned8ToComplex.h>
+// pydoc.h is automatically generated in the build directory
+#include <Unsigned8ToComplex_pydoc.h>
+
+void bind_Unsigned8ToComplex(py::module& m)
+{
+
+    using Unsigned8ToComplex    = ::gr::grnet::Unsigned8ToComplex;
+
+
+    py::class_<Unsigned8ToComplex, gr::sync_decimator,
+        std::shared_ptr<Unsigned8ToComplex>>(m, "Unsigned8ToComplex", D(Unsigned8ToComplex))
+
+        .def(py::init(&Unsigned8ToComplex::make),
+           py::arg("nontemporalThreshold") = 0,
+           D(Unsigned8ToComplex,make)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -24,4 +24,7 @@
 
  static const char *__doc_gr_grnet_ComplexToSC16_make = R"doc()doc";
 
+
+ static const char *__doc_gr_grnet_ComplexToSC16_saturated = R"doc()doc";
+
   
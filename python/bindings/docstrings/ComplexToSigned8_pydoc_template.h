@@ -24,4 +24,7 @@
 
  static const char *__doc_gr_grnet_ComplexToSigned8_make = R"doc()doc";
 
+
+ static const char *__doc_gr_grnet_ComplexToSigned8_saturated = R"doc()doc";
+
   
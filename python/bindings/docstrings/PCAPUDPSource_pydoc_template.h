@@ -24,4 +24,22 @@
 
  static const char *__doc_gr_grnet_PCAPUDPSource_make = R"doc()doc";
 
+
+ static const char *__doc_gr_grnet_PCAPUDPSource_pacing_error_mean_us = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_PCAPUDPSource_pacing_error_max_us = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_PCAPUDPSource_packets_paced = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_PCAPUDPSource_datagrams_reassembled = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_PCAPUDPSource_datagrams_incomplete = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_PCAPUDPSource_build_index = R"doc()doc";
+
   
@@ -24,4 +24,13 @@
 
  static const char *__doc_gr_grnet_tcp_sink_make = R"doc()doc";
 
+
+ static const char *__doc_gr_grnet_tcp_sink_zerocopy_copied_sends = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_tcp_sink_write_count = R"doc()doc";
+
+
+ static const char *__doc_gr_grnet_tcp_sink_avg_write_size = R"doc()doc";
+
   
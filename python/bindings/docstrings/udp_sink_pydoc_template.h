@@ -24,4 +24,7 @@
 
  static const char *__doc_gr_grnet_udp_sink_make = R"doc()doc";
 
+
+ static const char *__doc_gr_grnet_udp_sink_zerocopy_copied_sends = R"doc()doc";
+
   
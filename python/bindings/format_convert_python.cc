@@ -0,0 +1,71 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(format_convert.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(ed8d9083f3e905459035eb76d5cfffb8)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/format_convert.h>
+// pydoc.h is automatically generated in the build directory
+#include <format_convert_pydoc.h>
+
+void bind_format_convert(py::module& m)
+{
+
+    using format_convert    = ::gr::grnet::format_convert;
+
+
+    py::class_<format_convert, gr::sync_block,
+        std::shared_ptr<format_convert>>(m, "format_convert", D(format_convert))
+
+        .def(py::init(&format_convert::make),
+           py::arg("inputFormat"),
+           py::arg("outputFormat"),
+           py::arg("bigEndian") = false,
+           py::arg("scale") = 1.0f,
+           py::arg("vlen") = 1,
+           py::arg("nthreads") = 1,
+           py::arg("nontemporalThreshold") = 0,
+           D(format_convert,make)
+        )
+
+
+        .def("saturated",&format_convert::saturated,       
+            D(format_convert,saturated)
+        )
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
+
+
+
+
+
+
@@ -30,10 +30,24 @@ namespace py = pybind11;
     void bind_Int16BytesToComplex(py::module& m);
     void bind_IShortToSC16(py::module& m);
     void bind_PCAPUDPSource(py::module& m);
+    void bind_PCAPUDPSink(py::module& m);
     void bind_SC16ToBytes(py::module& m);
     void bind_SC16ToComplex(py::module& m);
+    void bind_ComplexToSC12(py::module& m);
+    void bind_SC12ToComplex(py::module& m);
+    void bind_ComplexToSC4(py::module& m);
+    void bind_SC4ToComplex(py::module& m);
+    void bind_ComplexToUnsigned8(py::module& m);
+    void bind_Unsigned8ToComplex(py::module& m);
+    void bind_ComplexToFP16(py::module& m);
+    void bind_FP16ToComplex(py::module& m);
+    void bind_IntComplexFIRDecimator(py::module& m);
+    void bind_format_convert(py::module& m);
     void bind_SC16ToIShort(py::module& m);
     void bind_Signed8ToComplex(py::module& m);
+    void bind_shm_sink(py::module& m);
+    void bind_shm_source(py::module& m);
+    void bind_tcp_framed_source(py::module& m);
     void bind_tcp_sink(py::module& m);
     void bind_udp_sink(py::module& m);
     void bind_udp_source(py::module& m);
@@ -74,10 +88,24 @@ PYBIND11_MODULE(grnet_python, m)
     bind_Int16BytesToComplex(m);
     bind_IShortToSC16(m);
     bind_PCAPUDPSource(m);
+    bind_PCAPUDPSink(m);
     bind_SC16ToBytes(m);
     bind_SC16ToComplex(m);
+    bind_ComplexToSC12(m);
+    bind_SC12ToComplex(m);
+    bind_ComplexToSC4(m);
+    bind_SC4ToComplex(m);
+    bind_ComplexToUnsigned8(m);
+    bind_Unsigned8ToComplex(m);
+    bind_ComplexToFP16(m);
+    bind_FP16ToComplex(m);
+    bind_IntComplexFIRDecimator(m);
+    bind_format_convert(m);
     bind_SC16ToIShort(m);
     bind_Signed8ToComplex(m);
+    bind_shm_sink(m);
+    bind_shm_source(m);
+    bind_tcp_framed_source(m);
     bind_tcp_sink(m);
     bind_udp_sink(m);
     bind_udp_source(m);
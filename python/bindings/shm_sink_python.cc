@@ -0,0 +1,64 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(shm_sink.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(11fc8d23c0f5ef4302c7ae7417cf79b6)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/shm_sink.h>
+// pydoc.h is automatically generated in the build directory
+#include <shm_sink_pydoc.h>
+
+void bind_shm_sink(py::module& m)
+{
+
+    using shm_sink    = ::gr::grnet::shm_sink;
+
+
+    py::class_<shm_sink, gr::sync_block, gr::block, gr::basic_block,
+        std::shared_ptr<shm_sink>>(m, "shm_sink", D(shm_sink))
+
+        .def(py::init(&shm_sink::make),
+           py::arg("itemsize"),
+           py::arg("vecLen"),
+           py::arg("name"),
+           py::arg("ringSize") = 16777216,
+           py::arg("lossless") = true,
+           D(shm_sink,make)
+        )
+
+
+        .def("active_readers",&shm_sink::active_readers,       
+            D(shm_sink,active_readers)
+        )
+
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2020 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(tcp_framed_source.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(58762e4e1f3ced93877f8749fdd3a4ae)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <grnet/tcp_framed_source.h>
+// pydoc.h is automatically generated in the build directory
+#include <tcp_framed_source_pydoc.h>
+
+void bind_tcp_framed_source(py::module& m)
+{
+
+    using tcp_framed_source    = ::gr::grnet::tcp_framed_source;
+
+
+    py::class_<tcp_framed_source, gr::sync_block, gr::block, gr::basic_block,
+        std::shared_ptr<tcp_framed_source>>(m, "tcp_framed_source", D(tcp_framed_source))
+
+        .def(py::init(&tcp_framed_source::make),
+           py::arg("itemsize"),
+           py::arg("vecLen"),
+           py::arg("host"),
+           py::arg("port"),
+           py::arg("sourceMode") = 1,
+           py::arg("notifyMissed") = true,
+           D(tcp_framed_source,make)
+        )
+
+
+        .def("frames_received",&tcp_framed_source::frames_received,       
+            D(tcp_framed_source,frames_received)
+        )
+
+
+        .def("frames_missed",&tcp_framed_source::frames_missed,       
+            D(tcp_framed_source,frames_missed)
+        )
+
+
+        
+
+
+
+        ;
+
+
+
+
+}
+
+
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(tcp_sink.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(237eba72fe0c5f765bc782e08a65a2c0)                     */
+/* BINDTOOL_HEADER_FILE_HASH(76c98ed205d8b85fade61fb7abe116eb)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -42,8 +42,31 @@ void bind_tcp_sink(py::module& m)
            py::arg("host"),
            py::arg("port"),
            py::arg("sinkMode"),
+           py::arg("zerocopy") = false,
+           py::arg("profile") = 0,
+           py::arg("coalesceSize") = 65536,
+           py::arg("coalesceTimeoutUs") = 2000,
+           py::arg("frameMode") = 0,
            D(tcp_sink,make)
         )
+
+
+        .def("zerocopy_copied_sends",&tcp_sink::zerocopy_copied_sends,       
+            D(tcp_sink,zerocopy_copied_sends)
+        )
+
+
+        .def("write_count",&tcp_sink::write_count,       
+            D(tcp_sink,write_count)
+        )
+
+
+        .def("avg_write_size",&tcp_sink::avg_write_size,       
+            D(tcp_sink,avg_write_size)
+        )
+
+
+
         
 
 
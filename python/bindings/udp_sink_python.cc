@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(udp_sink.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(455ef66a15b6de675e76120e8cf5422a)                     */
+/* BINDTOOL_HEADER_FILE_HASH(dc85bd465e1cfe515b7c71f15fadb15f)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -44,8 +44,15 @@ void bind_udp_sink(py::module& m)
            py::arg("headerType"),
            py::arg("payloadsize"),
            py::arg("send_eof"),
+           py::arg("zerocopy") = false,
            D(udp_sink,make)
         )
+
+
+        .def("zerocopy_copied_sends",&udp_sink::zerocopy_copied_sends,       
+            D(udp_sink,zerocopy_copied_sends)
+        )
+
         
 
 